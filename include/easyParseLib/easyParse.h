@@ -33,6 +33,13 @@
 #include <cstdint>
 #include <string>
 #include <stdexcept>
+#include <vector>
+#include <ranges>
+#include <iterator>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <system_error>
 
 #include <easyMathLib/easyMath.h>
 
@@ -72,6 +79,143 @@ namespace easyParse
         constexpr BuildType versionBuild = BuildType::ALPHA;
     }
 
+    /// @brief Character class flags of \ref `CHARACTER_CLASS_TABLE`.
+    namespace charClass
+    {
+        /// @brief Mask of quote class, used as column of quote state machine.
+        constexpr std::uint8_t QUOTE_CLASS_MASK = 0b11;
+
+        /// @brief Quote class: any character without quote meaning.
+        constexpr std::uint8_t OTHER = 0;
+
+        /// @brief Quote class: \ character.
+        constexpr std::uint8_t BACKSLASH = 1;
+
+        /// @brief Quote class: ' character.
+        constexpr std::uint8_t SINGLE_QUOTE = 2;
+
+        /// @brief Quote class: " character.
+        constexpr std::uint8_t DOUBLE_QUOTE = 3;
+
+        /// @brief Flag: octal digit.
+        constexpr std::uint8_t OCT_DIGIT = 1 << 2;
+
+        /// @brief Flag: decimal digit.
+        constexpr std::uint8_t DEC_DIGIT = 1 << 3;
+
+        /// @brief Flag: hexadecimal digit.
+        constexpr std::uint8_t HEX_DIGIT = 1 << 4;
+    }
+
+    /// @brief Class of every character, indexed by `unsigned char` value.
+    constexpr std::array<std::uint8_t, 256> CHARACTER_CLASS_TABLE = []()
+    {
+        std::array<std::uint8_t, 256> table = {};
+
+        table['\\'] = charClass::BACKSLASH;
+        table['\''] = charClass::SINGLE_QUOTE;
+        table['\"'] = charClass::DOUBLE_QUOTE;
+
+        for(std::size_t ch = '0'; ch <= '9'; ++ch)
+            table[ch] |= charClass::DEC_DIGIT | charClass::HEX_DIGIT | ((ch < '8') ? charClass::OCT_DIGIT : 0);
+
+        for(std::size_t ch = 0; ch < 6; ++ch)
+        {
+            table['a' + ch] |= charClass::HEX_DIGIT;
+            table['A' + ch] |= charClass::HEX_DIGIT;
+        }
+
+        return table;
+    }();
+
+    /**
+     * @brief Get class flags of character.
+     * 
+     * @param[in] ch character to classify.
+     * @return std::uint8_t class flags, see `charClass`.
+     */
+    [[nodiscard]] constexpr inline std::uint8_t characterClass(char ch) noexcept
+    {
+        return CHARACTER_CLASS_TABLE[static_cast<unsigned char>(ch)];
+    }
+
+    /// @brief State of quoted text state machine.
+    enum class QuoteState : std::uint8_t
+    {
+        /// @brief Outside any quoted text.
+        OUTSIDE,
+
+        /// @brief After \ outside quoted text.
+        OUTSIDE_ESCAPE,
+
+        /// @brief Inside '' text.
+        SINGLE,
+
+        /// @brief After \ inside '' text.
+        SINGLE_ESCAPE,
+
+        /// @brief Inside "" text.
+        DOUBLE,
+
+        /// @brief After \ inside "" text.
+        DOUBLE_ESCAPE
+    };
+
+    /// @brief Event reported by quoted text state machine for each character.
+    enum class QuoteEvent : std::uint8_t
+    {
+        /// @brief Plain character outside quoted text.
+        TEXT,
+
+        /// @brief \ beginning an escape sequence outside quoted text.
+        ESCAPE,
+
+        /// @brief Character following \ outside quoted text.
+        ESCAPED,
+
+        /// @brief Opening ' or ".
+        QUOTE_OPEN,
+
+        /// @brief Character inside quoted text.
+        QUOTED,
+
+        /// @brief \ beginning an escape sequence inside quoted text.
+        QUOTED_ESCAPE,
+
+        /// @brief Closing ' or ".
+        QUOTE_CLOSE
+    };
+
+    /// @brief Transition of quoted text state machine.
+    struct QuoteTransition
+    {
+        QuoteState next;
+        QuoteEvent event;
+    };
+
+    /// @brief Transitions indexed by [`QuoteState`][quote class of character].
+    constexpr std::array<std::array<QuoteTransition, 4>, 6> QUOTE_TRANSITION_TABLE = {{
+        // OTHER                                        BACKSLASH                                               SINGLE_QUOTE                                        DOUBLE_QUOTE
+        {{ {QuoteState::OUTSIDE, QuoteEvent::TEXT},     {QuoteState::OUTSIDE_ESCAPE, QuoteEvent::ESCAPE},       {QuoteState::SINGLE, QuoteEvent::QUOTE_OPEN},       {QuoteState::DOUBLE, QuoteEvent::QUOTE_OPEN} }},    // OUTSIDE
+        {{ {QuoteState::OUTSIDE, QuoteEvent::ESCAPED},  {QuoteState::OUTSIDE, QuoteEvent::ESCAPED},             {QuoteState::OUTSIDE, QuoteEvent::ESCAPED},         {QuoteState::OUTSIDE, QuoteEvent::ESCAPED} }},      // OUTSIDE_ESCAPE
+        {{ {QuoteState::SINGLE, QuoteEvent::QUOTED},    {QuoteState::SINGLE_ESCAPE, QuoteEvent::QUOTED_ESCAPE}, {QuoteState::OUTSIDE, QuoteEvent::QUOTE_CLOSE},     {QuoteState::SINGLE, QuoteEvent::QUOTED} }},        // SINGLE
+        {{ {QuoteState::SINGLE, QuoteEvent::QUOTED},    {QuoteState::SINGLE, QuoteEvent::QUOTED},               {QuoteState::SINGLE, QuoteEvent::QUOTED},           {QuoteState::SINGLE, QuoteEvent::QUOTED} }},        // SINGLE_ESCAPE
+        {{ {QuoteState::DOUBLE, QuoteEvent::QUOTED},    {QuoteState::DOUBLE_ESCAPE, QuoteEvent::QUOTED_ESCAPE}, {QuoteState::DOUBLE, QuoteEvent::QUOTED},           {QuoteState::OUTSIDE, QuoteEvent::QUOTE_CLOSE} }},  // DOUBLE
+        {{ {QuoteState::DOUBLE, QuoteEvent::QUOTED},    {QuoteState::DOUBLE, QuoteEvent::QUOTED},               {QuoteState::DOUBLE, QuoteEvent::QUOTED},           {QuoteState::DOUBLE, QuoteEvent::QUOTED} }}         // DOUBLE_ESCAPE
+    }};
+
+    /**
+     * @brief Advance quoted text state machine over a character.
+     * 
+     * @param[in] state current state.
+     * @param[in] ch character to consume.
+     * @return QuoteTransition next state and event for the character.
+     */
+    [[nodiscard]] constexpr inline QuoteTransition quoteTransition(QuoteState state, char ch) noexcept
+    {
+        return QUOTE_TRANSITION_TABLE[static_cast<std::size_t>(state)][characterClass(ch) & charClass::QUOTE_CLASS_MASK];
+    }
+
     /**
      * @brief Convert hex character to numeric value.
      * 
@@ -106,7 +250,7 @@ namespace easyParse
      */
     [[nodiscard]] constexpr inline bool isOctalDigit(char ch) noexcept
     {
-        return easyMath::valueBetweenInclusive<char>(ch, '0', '7');
+        return characterClass(ch) & charClass::OCT_DIGIT;
     }
 
     /**
@@ -116,14 +260,7 @@ namespace easyParse
      */
     [[nodiscard]] constexpr inline bool isHexDigit(char digit) noexcept
     {
-        if(easyMath::valueBetweenInclusive<char>(digit, '0', '9'))
-            return digit - '0';
-        else if(easyMath::valueBetweenInclusive<char>(digit, 'a', 'f'))
-            return digit - 'a' + 10;
-        else if(easyMath::valueBetweenInclusive<char>(digit, 'A', 'F'))
-            return digit - 'A' + 10;
-        else
-            return 0;
+        return characterClass(digit) & charClass::HEX_DIGIT;
     }
 
     /**
@@ -133,7 +270,7 @@ namespace easyParse
      */
     [[nodiscard]] constexpr inline bool isDecDigit(char ch) noexcept
     {
-        return easyMath::valueBetweenInclusive<char>(ch, '0', '9');
+        return characterClass(ch) & charClass::DEC_DIGIT;
     }
 
     /**
@@ -373,21 +510,173 @@ namespace easyParse
         return ret;
     }
 
-    constexpr std::string_view WHITESPACE_STRING = " \n\t\r\0";
+    /// @brief Whitespace characters, same set as \ref `WHITESPACE_BITMAP`.
+    constexpr std::string_view WHITESPACE_STRING = " \n\t\r";
+
+    /// @brief 256 bit set of whitespace characters, indexed by `unsigned char` value.
+    constexpr std::array<std::uint64_t, 4> WHITESPACE_BITMAP = []()
+    {
+        std::array<std::uint64_t, 4> bitmap = {};
+
+        for(char ch : WHITESPACE_STRING)
+        {
+            auto index = static_cast<unsigned char>(ch);
+            bitmap[index >> 6] |= (1ull << (index & 63));
+        }
+
+        return bitmap;
+    }();
+
+    /**
+     * @brief Check if character is whitespace.
+     * 
+     * @param[in] ch character to evaluate.
+     */
+    [[nodiscard]] constexpr inline bool isWhiteSpace(char ch) noexcept
+    {
+        auto index = static_cast<unsigned char>(ch);
+        return (WHITESPACE_BITMAP[index >> 6] >> (index & 63)) & 1ull;
+    }
+
+    namespace impl_detail_
+    {
+        /// @brief Repeat byte into every byte of 64 bit word.
+        [[nodiscard]] constexpr inline std::uint64_t broadcastByte_(char ch) noexcept
+        {
+            return 0x0101010101010101ull * static_cast<unsigned char>(ch);
+        }
+
+        /**
+         * @brief Mark bytes of 8 character word that are not whitespace.
+         * 
+         * @param[in] word 8 characters loaded in native byte order.
+         * @return std::uint64_t word with high bit of each non whitespace byte set.
+         */
+        [[nodiscard]] constexpr inline std::uint64_t nonWhiteSpaceBytes_(std::uint64_t word) noexcept
+        {
+            constexpr std::uint64_t LOW_7 = 0x7F7F7F7F7F7F7F7Full;
+            std::uint64_t ret = 0x8080808080808080ull;
+
+            for(char ch : WHITESPACE_STRING)
+            {
+                auto diff = word ^ broadcastByte_(ch);
+                ret &= ((diff & LOW_7) + LOW_7) | diff;
+            }
+
+            return ret & 0x8080808080808080ull;
+        }
+
+        /// @brief Whether 8 byte word at a time scanning can be used (little endian host).
+        constexpr bool canScanWords_ = (std::endian::native == std::endian::little);
+
+        [[nodiscard]] inline std::uint64_t loadWord_(const char* data) noexcept
+        {
+            std::uint64_t word;
+            std::memcpy(&word, data, sizeof(word));
+            return word;
+        }
+    }
 
     /**
      * @brief Find offset at which the first non-whitespace character exists, evalution from given offset.
      * 
+     * Scans 8 characters at a time outside constant evaluation.
+     * 
      * @param[in] line line to evaluate.
-     * @param[in] offset offset to start from.
-     * @return std::size_t offset of first non-whitespace character from offset.
+     * @param[in] offset offset to start from, may be past end (`npos`).
+     * @return std::size_t offset of first non-whitespace character from offset, `npos` if none.
      */
     [[nodiscard]] constexpr inline std::size_t advanceOverWhiteSpace(
         std::string_view line,
         std::size_t offset = 0
     ) noexcept
     {
-        return line.find_first_not_of(WHITESPACE_STRING, offset);
+        if(offset >= line.size())
+            return line.npos;
+
+        if constexpr (impl_detail_::canScanWords_)
+        {
+            if(!std::is_constant_evaluated())
+            {
+                while(line.size() - offset >= 8)
+                {
+                    auto mask = impl_detail_::nonWhiteSpaceBytes_(impl_detail_::loadWord_(line.data() + offset));
+
+                    if(mask != 0)
+                        return offset + (std::countr_zero(mask) >> 3);
+
+                    offset += 8;
+                }
+            }
+        }
+
+        for(; offset < line.size(); ++offset)
+            if(!isWhiteSpace(line[offset]))
+                return offset;
+
+        return line.npos;
+    }
+
+    /**
+     * @brief Find offset of last non-whitespace character at or before `end - 1`.
+     * 
+     * Scans 8 characters at a time outside constant evaluation.
+     * 
+     * @param[in] line line to evaluate.
+     * @param[in] end offset one past last character to consider.
+     * @return std::size_t offset of last non-whitespace character, `npos` if none.
+     */
+    [[nodiscard]] constexpr inline std::size_t retreatOverWhiteSpace(
+        std::string_view line,
+        std::size_t end = std::string_view::npos
+    ) noexcept
+    {
+        if(end > line.size())
+            end = line.size();
+
+        if constexpr (impl_detail_::canScanWords_)
+        {
+            if(!std::is_constant_evaluated())
+            {
+                while(end >= 8)
+                {
+                    auto mask = impl_detail_::nonWhiteSpaceBytes_(impl_detail_::loadWord_(line.data() + end - 8));
+
+                    if(mask != 0)
+                        return end - 1 - (std::countl_zero(mask) >> 3);
+
+                    end -= 8;
+                }
+            }
+        }
+
+        while(end > 0)
+        {
+            --end;
+            if(!isWhiteSpace(line[end]))
+                return end;
+        }
+
+        return line.npos;
+    }
+
+    /**
+     * @brief Find offset of first whitespace character, evalution from given offset.
+     * 
+     * @param[in] line line to evaluate.
+     * @param[in] offset offset to start from.
+     * @return std::size_t offset of first whitespace character from offset, `npos` if none.
+     */
+    [[nodiscard]] constexpr inline std::size_t findFirstWhiteSpace(
+        std::string_view line,
+        std::size_t offset = 0
+    ) noexcept
+    {
+        for(; offset < line.size(); ++offset)
+            if(isWhiteSpace(line[offset]))
+                return offset;
+
+        return line.npos;
     }
 
     /**
@@ -401,12 +690,13 @@ namespace easyParse
         const std::string_view& line
     ) noexcept
     {
-        auto begin = line.find_first_not_of(WHITESPACE_STRING);
-        auto end = line.find_last_not_of(WHITESPACE_STRING);
+        auto begin = advanceOverWhiteSpace(line);
 
         if(begin == line.npos)
             return {};
 
+        auto end = retreatOverWhiteSpace(line);
+
         return line.substr(begin, end - begin + 1);
     }
 
@@ -599,7 +889,6 @@ namespace easyParse
         if(iterator >= sentinal)
             throw std::invalid_argument("Empty String to advance over");
 
-        auto begin = iterator;
         char ch = *iterator;
         ++iterator;            
 
@@ -618,18 +907,8 @@ namespace easyParse
                             throw std::invalid_argument("Expected Value after \\[x,X]");
 
                         auto hexBegin = iterator - 2;
-                        ch = *iterator;
-                        while (
-                            (iterator < sentinal)
-                            && (std::isxdigit(ch))
-                        )
-                        {
+                        while((iterator < sentinal) && isHexDigit(*iterator))
                             ++iterator;
-                            if(iterator < sentinal)
-                                ch = *iterator;
-                            else 
-                                break;
-                        }
 
                         return 
                         {
@@ -641,18 +920,8 @@ namespace easyParse
                 case 'O':
                     {
                         auto octBegin = iterator - 2;
-                        ch = *iterator;
-                        while (
-                            (iterator < sentinal)
-                            && (ch < '8') && (ch >= '0')
-                        )
-                        {
+                        while((iterator < sentinal) && isOctalDigit(*iterator))
                             ++iterator;
-                            if(iterator < sentinal)
-                                ch = *iterator;
-                            else 
-                                break;                          
-                        }
 
                         return 
                         {
@@ -705,6 +974,168 @@ namespace easyParse
         return ret;
     }
 
+    /**
+     * @brief Find offset of first delimiter not enclosed by '' or "".
+     * 
+     * - " and ' can be escaped by \
+     * - Any character following \ is never taken as a delimiter.
+     * 
+     * @param[in] string string to evaluate.
+     * @param[in] delim delimiter character.
+     * @return std::size_t offset of delimiter, `npos` if not present.
+     */
+    [[nodiscard]] constexpr inline std::size_t findFirstUnquoted(
+        std::string_view string,
+        char delim
+    ) noexcept
+    {
+        auto state = QuoteState::OUTSIDE;
+
+        for(std::size_t i = 0; i < string.size(); ++i)
+        {
+            auto transition = quoteTransition(state, string[i]);
+            state = transition.next;
+
+            if((transition.event == QuoteEvent::TEXT) && (string[i] == delim))
+                return i;
+        }
+
+        return string.npos;
+    }
+
+    /**
+     * @brief Extract string till a delimiter not enclosed by '' or "", 
+     * modify initial string to remove the extracted string and delimiter.
+     * 
+     * @param[inout] string string to process. modified to be string after delimiter.
+     * @param[in] delim delimiter character.
+     * @return std::string_view extracted string.
+     */
+    [[nodiscard]] constexpr inline std::string_view extractTillUnquotedDelimiter(
+        std::string_view& string,
+        char delim = ','
+    ) noexcept
+    {
+        auto find = findFirstUnquoted(string, delim);
+        auto ret = string;
+        if(find == string.npos)
+            string = {};
+        else
+        {
+            ret = string.substr(0, find);
+            string = string.substr(find + 1);
+        }
+        return ret;
+    }
+
+    /**
+     * @brief Lazy view of substrings split based on location of the delimiters.
+     * 
+     * Splits as \ref `splitUsingDelimiterList` does, i-th split uses i-th delimiter 
+     * and the last delimiter is used for all remaining splits, but substrings are 
+     * produced while iterating, without allocation.
+     * 
+     * `delimiters` is not copied, it must outlive the view.
+     * 
+     * @tparam isQuoteAware if true, delimiters enclosed by '' or "" do not split.
+     */
+    template<bool isQuoteAware>
+    class BasicSplitView : public std::ranges::view_interface<BasicSplitView<isQuoteAware>>
+    {
+        std::string_view string_;
+        std::string_view delimiters_;
+
+    public:
+
+        /// @brief Forward iterator over split substrings.
+        class Iterator
+        {
+            std::string_view remaining_;
+            std::string_view current_;
+            std::string_view delimiters_;
+            std::size_t delimIndex_;
+            bool isEnd_;
+
+            constexpr inline void extract_() noexcept
+            {
+                if(remaining_.empty())
+                {
+                    isEnd_ = true;
+                    return;
+                }
+
+                if(delimiters_.empty())
+                {
+                    current_ = remaining_;
+                    remaining_ = {};
+                    return;
+                }
+
+                char delim = delimiters_[(delimIndex_ < delimiters_.size()) ? delimIndex_ : (delimiters_.size() - 1)];
+                ++delimIndex_;
+
+                if constexpr (isQuoteAware)
+                    current_ = extractTillUnquotedDelimiter(remaining_, delim);
+                else
+                    current_ = extractTillDelimiter(remaining_, delim);
+            }
+
+        public:
+            using value_type = std::string_view;
+            using difference_type = std::ptrdiff_t;
+            using iterator_concept = std::forward_iterator_tag;
+
+            constexpr inline Iterator() noexcept 
+                : remaining_(), current_(), delimiters_(), delimIndex_(0), isEnd_(true) {}
+
+            constexpr inline Iterator(std::string_view string, std::string_view delimiters) noexcept
+                : remaining_(string), current_(), delimiters_(delimiters), delimIndex_(0), isEnd_(false)
+            {
+                extract_();
+            }
+
+            constexpr inline std::string_view operator * () const noexcept { return current_; }
+
+            constexpr inline Iterator& operator ++ () noexcept
+            {
+                extract_();
+                return *this;
+            }
+
+            constexpr inline Iterator operator ++ (int) noexcept
+            {
+                auto ret = *this;
+                extract_();
+                return ret;
+            }
+
+            constexpr inline bool operator == (const Iterator& other) const noexcept
+            {
+                if(isEnd_ || other.isEnd_)
+                    return isEnd_ == other.isEnd_;
+
+                return (current_.data() == other.current_.data()) && (current_.size() == other.current_.size());
+            }
+
+            constexpr inline bool operator == (std::default_sentinel_t) const noexcept { return isEnd_; }
+        };
+
+        constexpr inline BasicSplitView() noexcept : string_(), delimiters_() {}
+
+        constexpr inline BasicSplitView(std::string_view string, std::string_view delimiters) noexcept
+            : string_(string), delimiters_(delimiters) {}
+
+        constexpr inline Iterator begin() const noexcept { return Iterator(string_, delimiters_); }
+
+        constexpr inline std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+    };
+
+    /// @brief Lazy split view, delimiters split anywhere in string.
+    using SplitView = BasicSplitView<false>;
+
+    /// @brief Lazy split view, delimiters enclosed by '' or "" do not split.
+    using QuotedSplitView = BasicSplitView<true>;
+
     /**
      * @brief Split string into substring based on location of the delimiters.
      * 
@@ -716,19 +1147,64 @@ namespace easyParse
      * @param[in] delim delimiter to split string.
      * @return std::vector<std::string_view> list of split substrings.
      */
-    [[nodiscard]] inline std::vector<std::string_view> splitUsingDelimiterList(std::string_view string, std::vector<char> delim = {','})
+    [[nodiscard]] inline std::vector<std::string_view> splitUsingDelimiterList(std::string_view string, const std::vector<char>& delim = {','})
     {
         std::vector<std::string_view> ret;
 
-        for(std::size_t i = 0; (i < delim.size()) && !string.empty(); ++i)
+        for(auto substring : SplitView(string, std::string_view(delim.data(), delim.size())))
+            ret.push_back(substring);
+
+        return ret;
+    }
+
+    /**
+     * @brief Scan string reporting quoted text spans and escape positions.
+     * 
+     * - Spans enclosed by "" or '' are reported including the quotes, as `[begin, end)`.
+     * - Position of every \ that begins an escape sequence (inside or outside quotes) is reported.
+     * - \" & \' inside text substring will not be taken as closing of string.
+     * 
+     * @tparam SpanReporter callable taking `(std::size_t begin, std::size_t end)`.
+     * @tparam EscapeReporter callable taking `(std::size_t position)`.
+     * @param[in] string string to scan.
+     * @param[in] reportSpan called for every closed quoted span.
+     * @param[in] reportEscape called for every escape sequence.
+     * @return true all quoted text was closed.
+     * @return false string ended inside quoted text.
+     */
+    template<class SpanReporter, class EscapeReporter>
+    constexpr inline bool scanQuotedText(
+        std::string_view string,
+        SpanReporter&& reportSpan,
+        EscapeReporter&& reportEscape
+    )
+    {
+        auto state = QuoteState::OUTSIDE;
+        std::size_t spanBegin = 0;
+
+        for(std::size_t i = 0; i < string.size(); ++i)
         {
-            ret.push_back(extractTillDelimiter(string, delim[i]));
-        }
+            auto transition = quoteTransition(state, string[i]);
+            state = transition.next;
 
-        while(!string.empty())
-            ret.push_back(extractTillDelimiter(string, delim.back()));
+            switch (transition.event)
+            {
+            case QuoteEvent::ESCAPE: [[fallthrough]];
+            case QuoteEvent::QUOTED_ESCAPE:
+                reportEscape(i);
+                break;
+            case QuoteEvent::QUOTE_OPEN:
+                spanBegin = i;
+                break;
+            case QuoteEvent::QUOTE_CLOSE:
+                reportSpan(spanBegin, i + 1);
+                break;
+            default:
+                break;
+            }
+        }
 
-        return ret;
+        return (state == QuoteState::OUTSIDE) || (state == QuoteState::OUTSIDE_ESCAPE);
     }
 
     /**
@@ -737,9 +1213,16 @@ namespace easyParse
      * - Ignores any substring enclosed by "" or ''
      * - " and ' can be escaped by \
      * - \" & \' inside text substring will not be taken as closing of string.
+     * - Escape sequence outside quoted text is stepped over as \ and the character after it,
+     *  and reported as \, without decoding it. A \ ending string is reported as \.
+     * 
+     * Escapes are not decoded, so malformed escapes (`\x` without digits) never throw. Before 
+     * quoted text was scanned by state machine, escapes outside quotes were decoded through 
+     * \ref `advanceOverText`: `a\nb` reported a newline rather than \, and malformed escapes 
+     * threw out of the `noexcept` \ref `advanceAndIgnoreQuotedText`, terminating.
      * 
      * calling on `hello"asd""asd"aa'a'` will return
-     * `helloaa` and `-1`.
+     * `helloaa` and `-1`. calling on `a\:b` will return `a`, `\`, `b` and `-1`.
      * 
      * @param[inout] iterator iterator to use.
      * @param[inout] sentinal sentinal to guard against out of range access.
@@ -748,59 +1231,37 @@ namespace easyParse
     constexpr inline std::pair<char, bool> advanceSkipReportQuotedText(
         std::string_view::const_iterator& iterator,
         std::string_view::const_iterator sentinal
-    )
+    ) noexcept
     {
-        std::pair<char, bool> eval;
-        char& charUnderEval = eval.first;
-        bool& isEscaped = eval.second;
-
-        bool isText = false;
-        bool isDoubleQuote = false;
-
-        eval = advanceOverText(iterator, sentinal);
-
-        std::pair<char, bool> ret;
-
-        isDoubleQuote = (charUnderEval == '\"');
-        isText = (!isEscaped ) && (isDoubleQuote || (charUnderEval == '\''));
-
-        if(!isText)
-            return {charUnderEval, false};
+        auto state = QuoteState::OUTSIDE;
+        bool isSkipped = false;
 
         while(iterator < sentinal)
         {
-            while ((iterator < sentinal) && (isText))
-            {
-                eval = advanceOverText(iterator, sentinal);
+            char ch = *iterator;
+            ++iterator;
 
-                if(isText)
-                {
-                    if((charUnderEval == '\"') && isDoubleQuote && (!isEscaped))
-                    {
-                        isText = false;
-                        isDoubleQuote = false;
-                    }
-                    else if ((charUnderEval == '\'') && (!isDoubleQuote) && (!isEscaped))
-                    {
-                        isText = false;
-                        isDoubleQuote = false;
-                    }
-                }
-            }
+            auto transition = quoteTransition(state, ch);
+            state = transition.next;
 
-            if(iterator < sentinal)
+            switch (transition.event)
             {
-                eval = advanceOverText(iterator, sentinal);
-
-                isDoubleQuote = (charUnderEval == '\"');
-                isText = (!isEscaped ) && (isDoubleQuote || (charUnderEval == '\''));
-
-                if(!isText)
-                    return {charUnderEval, true};
+            case QuoteEvent::TEXT:
+                return {ch, isSkipped};
+            case QuoteEvent::ESCAPED:
+                return {'\\', isSkipped};
+            case QuoteEvent::ESCAPE:
+                break;
+            default:
+                isSkipped = true;
+                break;
             }
         }
 
-        return {-1, true};
+        if(state == QuoteState::OUTSIDE_ESCAPE)
+            return {'\\', isSkipped};
+
+        return {-1, isSkipped};
     }
 
     /**
@@ -809,6 +1270,7 @@ namespace easyParse
      * - Ignores any substring enclosed by "" or ''
      * - " and ' can be escaped by \
      * - \" & \' inside text substring will not be taken as closing of string.
+     * - Escape sequence outside quoted text is reported as \, see \ref `advanceSkipReportQuotedText`.
      * 
      * calling on `hello"asd""asd"aa'a'` will return
      * `helloaa` and `-1`.
@@ -826,134 +1288,290 @@ namespace easyParse
     }
     
     /**
-     * @brief Get vector of stringes that were not enclosed by "" or '' in input string.
+     * @brief Lazy view of non empty substrings not enclosed by "" or ''.
+     * 
+     * Substrings are found while iterating, by the same quoted text state machine as 
+     * \ref `scanQuotedText`, without allocation. Substring after last closed quoted text 
+     * is produced only if string does not end inside quoted text.
+     */
+    class NonTextView : public std::ranges::view_interface<NonTextView>
+    {
+        std::string_view string_;
+
+    public:
+
+        /// @brief Forward iterator over non enclosed substrings.
+        class Iterator
+        {
+            std::string_view string_;
+            std::string_view current_;
+            std::size_t cursor_;
+            bool isEnd_;
+
+            constexpr inline void extract_() noexcept
+            {
+                auto state = QuoteState::OUTSIDE;
+                std::size_t begin = cursor_;
+                std::size_t spanBegin = cursor_;
+
+                for(; cursor_ < string_.size(); ++cursor_)
+                {
+                    auto transition = quoteTransition(state, string_[cursor_]);
+                    state = transition.next;
+
+                    if(transition.event == QuoteEvent::QUOTE_OPEN)
+                        spanBegin = cursor_;
+                    else if(transition.event == QuoteEvent::QUOTE_CLOSE)
+                    {
+                        if(spanBegin > begin)
+                        {
+                            current_ = string_.substr(begin, spanBegin - begin);
+                            ++cursor_;
+                            return;
+                        }
+
+                        begin = cursor_ + 1;
+                    }
+                }
+
+                bool isClosed = (state == QuoteState::OUTSIDE) || (state == QuoteState::OUTSIDE_ESCAPE);
+
+                if(isClosed && (begin < string_.size()))
+                {
+                    current_ = string_.substr(begin);
+                    return;
+                }
+
+                isEnd_ = true;
+            }
+
+        public:
+            using value_type = std::string_view;
+            using difference_type = std::ptrdiff_t;
+            using iterator_concept = std::forward_iterator_tag;
+
+            constexpr inline Iterator() noexcept : string_(), current_(), cursor_(0), isEnd_(true) {}
+
+            constexpr inline Iterator(std::string_view string) noexcept 
+                : string_(string), current_(), cursor_(0), isEnd_(false)
+            {
+                extract_();
+            }
+
+            constexpr inline std::string_view operator * () const noexcept { return current_; }
+
+            constexpr inline Iterator& operator ++ () noexcept
+            {
+                extract_();
+                return *this;
+            }
+
+            constexpr inline Iterator operator ++ (int) noexcept
+            {
+                auto ret = *this;
+                extract_();
+                return ret;
+            }
+
+            constexpr inline bool operator == (const Iterator& other) const noexcept
+            {
+                if(isEnd_ || other.isEnd_)
+                    return isEnd_ == other.isEnd_;
+
+                return (current_.data() == other.current_.data()) && (current_.size() == other.current_.size());
+            }
+
+            constexpr inline bool operator == (std::default_sentinel_t) const noexcept { return isEnd_; }
+        };
+
+        constexpr inline NonTextView() noexcept : string_() {}
+
+        constexpr inline NonTextView(std::string_view string) noexcept : string_(string) {}
+
+        constexpr inline Iterator begin() const noexcept { return Iterator(string_); }
+
+        constexpr inline std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+    };
+
+    /**
+     * @brief Get vector of non empty strings that were not enclosed by "" or '' in input string.
      * 
      * @param[in] string string to evaluate.
      * @return std::vector<std::string_view> list of non enclosed sub-strings.
      */
     [[nodiscard]] inline std::vector<std::string_view> extractNonText(std::string_view string)
     {
-        auto iterator = string.begin();
-        auto sentinal = string.end();
         std::vector<std::string_view> ret;
 
-        auto begin = string.begin();
+        for(auto substring : NonTextView(string))
+            ret.push_back(substring);
 
-        while (iterator < sentinal)
-        {
-            auto temp = iterator;
-            auto eval = advanceSkipReportQuotedText(iterator, sentinal);
-            if(eval.second)
-            {
-                ret.push_back(
-                    string.substr(std::ranges::distance(string.begin(), begin), std::ranges::distance(begin, temp))
-                );
-                begin = iterator;
-            }
-        }
         return ret;
     }
 
     /**
-     * @brief Convert number string to integer.
+     * @brief Result of \ref `parseNumber`, modelled on `std::from_chars_result`.
+     * 
+     * @tparam UInteger Type of integer.
+     */
+    template<easyMath::UnsignedIntegral UInteger>
+    struct ParseNumberResult
+    {
+        /// @brief Converted value, 0 on error.
+        UInteger value;
+
+        /// @brief Pointer to first character not consumed.
+        const char* ptr;
+
+        /// @brief `std::errc{}` on success, `invalid_argument` if no digits, `result_out_of_range` on overflow.
+        std::errc ec;
+    };
+
+    /**
+     * @brief Parse number from beginning of string without throwing.
      * 
      * Support for:
      * - 0x or 0X prefix hex.
-     * - 0b or 0B prefix octal.
+     * - 0b or 0B prefix binary.
      * - 0 prefix octal.
      * - No prefix decimal
      * - Negative numbers will produce 2's complement.
      * 
-     * @throw (1) `std::invalid_argument` : Empty string or only '-' passed.
-     * @throw (2) `std::invalid_argument` : Invalid characters (non hex in a 0x string or non binary in 0b ...).
+     * Like `std::from_chars`, parsing stops at the first character not valid for the base,
+     * `ptr` points to it. Value not fitting `UInteger`, or negative value whose magnitude 
+     * exceeds the signed range of `UInteger` (`-40000` for 16 bits), is reported as 
+     * `result_out_of_range`, with `ptr` past all digits.
      * 
      * @tparam UInteger Type of integer.
-     * @param[in] numberString number string to convert.
-     * @return UInteger Converted integer.
+     * @param[in] numberString number string to parse.
+     * @return ParseNumberResult<UInteger> value, end of consumed characters and error code.
      */
     template<easyMath::UnsignedIntegral UInteger>
-    [[nodiscard]] inline UInteger convertNumberString(std::string_view numberString)
+    [[nodiscard]] constexpr inline ParseNumberResult<UInteger> parseNumber(std::string_view numberString) noexcept
     {
-        if(numberString.size() == 0)
-            throw std::invalid_argument("empty string");
+        const char* iterator = numberString.data();
+        const char* sentinal = numberString.data() + numberString.size();
 
-        bool isNegative = (numberString[0] == '-');
+        bool isNegative = (iterator < sentinal) && (*iterator == '-');
 
         if(isNegative)
-            numberString = numberString.substr(1);
-        
-        if(numberString.size() == 0)
-            throw std::invalid_argument("string with - only");
+            ++iterator;
 
-        UInteger ret = 0;
+        if((iterator >= sentinal) || !isDecDigit(*iterator))
+            return {static_cast<UInteger>(0u), numberString.data(), std::errc::invalid_argument};
+
+        std::uint8_t base = 10;
+        std::uint8_t digitFlag = charClass::DEC_DIGIT;
 
-        if(numberString[0] == '0')
+        if(*iterator == '0')
         {
-            if(numberString.size() == 1)    
-                return 0;
-            else if((numberString[1] == 'x') || (numberString[1] == 'X'))
-            {
-                if(validateHexString(numberString.substr(2)))
-                    ret = convertHexString<UInteger>(numberString.substr(2));
-                else
-                    throw std::invalid_argument("Invalid characters in hex number string");
-            }
-            else if((numberString[1] == 'b') || (numberString[1] == 'B'))
+            ++iterator;
+
+            if(iterator < sentinal)
             {
-                if(validateBinString(numberString.substr(2)))
-                    ret = convertBinaryString<UInteger>(numberString.substr(2));
+                char prefix = *iterator;
+
+                if(((prefix == 'x') || (prefix == 'X')) && (iterator + 1 < sentinal) && isHexDigit(iterator[1]))
+                {
+                    base = 16;
+                    digitFlag = charClass::HEX_DIGIT;
+                    ++iterator;
+                }
+                else if(((prefix == 'b') || (prefix == 'B')) && (iterator + 1 < sentinal) && ((iterator[1] == '0') || (iterator[1] == '1')))
+                {
+                    base = 2;
+                    digitFlag = charClass::OCT_DIGIT;
+                    ++iterator;
+                }
                 else
-                    throw std::invalid_argument("Invalid characters in binary number string");
+                {
+                    base = 8;
+                    digitFlag = charClass::OCT_DIGIT;
+                }
             }
-            else if(validateOctString(numberString.substr(1)))
-                ret = convertOctString<UInteger>(numberString.substr(1));
+        }
+
+        const UInteger max = easyMath::NumericTraits<UInteger>::max();
+        UInteger ret = 0;
+        bool isOverflow = false;
+
+        for(; iterator < sentinal; ++iterator)
+        {
+            char ch = *iterator;
+
+            if(!(characterClass(ch) & digitFlag) || ((base == 2) && (ch > '1')))
+                break;
+
+            auto digit = static_cast<UInteger>(hexDigitConverter(ch));
+
+            if(ret > static_cast<UInteger>((max - digit) / base))
+                isOverflow = true;
             else
-                throw std::invalid_argument("Invalid characters in oct number string");
+                ret = static_cast<UInteger>(ret * base + digit);
         }
-        else if(validateDecString(numberString))
-            ret = convertDecimalString<UInteger>(numberString);
-        else
-            throw std::invalid_argument("Invalid characters in decimal number string");
+
+        if(isNegative && (ret > static_cast<UInteger>((max >> 1) + 1)))
+            isOverflow = true;
+
+        if(isOverflow)
+            return {static_cast<UInteger>(0u), iterator, std::errc::result_out_of_range};
 
         if(isNegative)
-            ret = ~ret + 1;
-        
-        return ret;
+            ret = static_cast<UInteger>(~ret + 1);
+
+        return {ret, iterator, std::errc{}};
+    }
+
+    /**
+     * @brief Convert number string to integer.
+     * 
+     * Support for:
+     * - 0x or 0X prefix hex.
+     * - 0b or 0B prefix binary.
+     * - 0 prefix octal.
+     * - No prefix decimal
+     * - Negative numbers will produce 2's complement.
+     * 
+     * @throw (1) `std::invalid_argument` : Empty string or only '-' passed.
+     * @throw (2) `std::invalid_argument` : Invalid characters (non hex in a 0x string or non binary in 0b ...).
+     * @throw (3) `std::out_of_range` : Value does not fit `UInteger`.
+     * 
+     * @tparam UInteger Type of integer.
+     * @param[in] numberString number string to convert.
+     * @return UInteger Converted integer.
+     */
+    template<easyMath::UnsignedIntegral UInteger>
+    [[nodiscard]] inline UInteger convertNumberString(std::string_view numberString)
+    {
+        auto result = parseNumber<UInteger>(numberString);
+
+        if(result.ec == std::errc::result_out_of_range)
+            throw std::out_of_range("Number string out of range of type");
+
+        if(result.ec != std::errc{})
+            throw std::invalid_argument("Empty or invalid number string");
+
+        if(result.ptr != numberString.data() + numberString.size())
+            throw std::invalid_argument("Invalid characters in number string");
+
+        return result.value;
     }
 
     /**
      * @brief Validates number string, for decimal, 
      * octal (if prefixed by 0), 
      * hex (if prefixed by 0x), 
-     * binary (if prefixed by )
+     * binary (if prefixed by 0b)
      * 
      * @param[in] numberString string to validate.
-     * @return bool true if valid number string.
+     * @return bool true if valid number string (false if empty).
      */
-    [[nodiscard]] inline bool validateNumberString(std::string_view numberString)
+    [[nodiscard]] constexpr inline bool validateNumberString(std::string_view numberString) noexcept
     {
-        if(numberString.size() == 0)
-            throw std::invalid_argument("empty string");
+        auto result = parseNumber<std::uint64_t>(numberString);
 
-        if((numberString[0] == '-'))
-            numberString = numberString.substr(1);
-        
-        if(numberString.size() == 0)
-            throw std::invalid_argument("string with - only");
-
-        if(numberString[0] == '0')
-        {
-            if(numberString.size() == 1)    
-                return true;
-            else if((numberString[1] == 'x') || (numberString[1] == 'X'))
-                return validateHexString(numberString.substr(2));
-            else if((numberString[1] == 'b') || (numberString[1] == 'B'))
-                return validateBinString(numberString.substr(2));
-            else 
-                return validateOctString(numberString.substr(1));
-        }
-        else 
-            return validateDecString(numberString);
+        return (result.ec != std::errc::invalid_argument) 
+            && (result.ptr == numberString.data() + numberString.size());
     }
 
     /**
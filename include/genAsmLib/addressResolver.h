@@ -30,7 +30,12 @@
 #define INCLUDE_GENASMLIB_ADDRESSRESOLVER_H_INCLUDED
 
 
+#include <algorithm>
+#include <limits>
+#include <span>
+
 #include "tokeniser.h"
+#include "memoryMap.h"
 
 namespace gen_asm
 {
@@ -50,42 +55,549 @@ namespace gen_asm
         noexcept(trait.getInstrWidthInBasic(op));
     };
 
+    /**
+     * @brief Check if address resolver traits also give widths as constexpr tables.
+     * 
+     * Must Have:
+     * 
+     * @conceptMember{Constants}
+     * - `static constexpr sizeWidthTable`
+     *      - Indexable by every value of `IsaTraits::BlockSizeType`, width of block size in basic units.
+     * - `static constexpr instrWidthTable`
+     *      - Indexable by every value of `IsaTraits::OpCodeType`, width of instruction in basic units.
+     * 
+     * Widths of many tokens are then summed by table lookup, without calls or branches.
+     */
+    template<class AddrTraits, class IsaTraits>
+    concept WidthTableTraitModel = AddressResolverTraitModel<AddrTraits, IsaTraits> && requires
+    {
+        { AddrTraits::sizeWidthTable[std::size_t{}] } -> std::convertible_to<std::size_t>;
+        { AddrTraits::instrWidthTable[std::size_t{}] } -> std::convertible_to<std::size_t>;
+
+        requires AddrTraits::sizeWidthTable.size() > std::numeric_limits<typename IsaTraits::BlockSizeType>::max();
+        requires AddrTraits::instrWidthTable.size() > std::numeric_limits<typename IsaTraits::OpCodeType>::max();
+    };
+
+    /**
+     * @brief Total width in basic units of instructions with op codes.
+     * 
+     * With width tables the loop is a plain gather and add over contiguous op codes, 
+     * left to the compiler to vectorise.
+     */
+    template<IsaTraitModel IsaTraits, AddressResolverTraitModel<IsaTraits> AddrTraits>
+    inline std::size_t sumInstrWidths(const AddrTraits& traits, std::span<const typename IsaTraits::OpCodeType> opCodes) noexcept
+    {
+        std::size_t total = 0;
+
+        if constexpr (WidthTableTraitModel<AddrTraits, IsaTraits>)
+        {
+            for(auto op : opCodes)
+                total += AddrTraits::instrWidthTable[op];
+        }
+        else
+        {
+            for(auto op : opCodes)
+                total += traits.getInstrWidthInBasic(op);
+        }
+
+        return total;
+    }
+
+    namespace literal
+    {
+        // Default sections
+
+        constexpr std::string_view TEXT_SECTION = ".text";
+        constexpr std::string_view VECTORS_SECTION = ".vectors";
+        constexpr std::string_view DATA_SECTION = ".data";
+        constexpr std::string_view RODATA_SECTION = ".rodata";
+        constexpr std::string_view BSS_SECTION = ".bss";
+    }
+
+    /// @brief Kind of section, deciding which counter advances in it and whether it occupies image.
+    enum class SectionKind : std::uint8_t
+    {
+        /// @brief Instructions, in code address space.
+        CODE,
+
+        /// @brief Initialised data, in data address space.
+        DATA,
+
+        /// @brief Initialised data placed in read only memory, in data address space.
+        READ_ONLY,
+
+        /// @brief Zero initialised data, takes no space in image.
+        ZERO
+    };
+
+    /**
+     * @brief Run of units holding the same value, reserved by `.align`, `.fill` or `.zero`.
+     * 
+     * Kept as a descriptor instead of expanding into initial values, so large buffers cost 
+     * nothing at assembly time.
+     * 
+     * @tparam IsaTraits All ISA types.
+     */
+    template<IsaTraitModel IsaTraits>
+    struct FillRegion
+    {
+        /// @brief Offset of first unit, relative to section, or to unit base when returned by `getCodeFills`, `getDataFills`.
+        std::size_t offset;
+
+        /// @brief Number of basic units.
+        std::size_t count;
+
+        /// @brief Value of every unit.
+        typename IsaTraits::LargestType value;
+    };
+
+    /**
+     * @brief Named section with its own offset counter, base address and alignment.
+     * 
+     * @tparam IsaTraits All ISA types.
+     */
+    template<IsaTraitModel IsaTraits>
+    struct Section
+    {
+        std::string name;
+        SectionKind kind;
+
+        /// @brief Alignment of base address, in basic units.
+        typename IsaTraits::AddressType alignment;
+
+        /// @brief Size of contents so far, offset of next item.
+        typename IsaTraits::AddressType offset;
+
+        /// @brief Base address relative to base of unit in its address space.
+        typename IsaTraits::AddressType baseAddress;
+
+        /// @brief Base address set explicitly, kept by layout.
+        bool isPinned;
+
+        /// @brief Fill regions in order of offset, empty for zero initialised sections.
+        std::vector<FillRegion<IsaTraits>> fills;
+
+        inline bool isCode() const noexcept { return kind == SectionKind::CODE; }
+        inline bool occupiesImage() const noexcept { return kind != SectionKind::ZERO; }
+    };
+
+    /**
+     * @brief Track code and data offsets of a translation unit across named sections.
+     * 
+     * Code of instructions goes to current code section, data symbols to current data section. 
+     * `.text` and `.data` are current at start, and laid out first in their address space,
+     * so units not using sections have the same layout as with single code and data counters.
+     * 
+     * Offsets are checked against wrap around of `AddressType`, and layout places sections 
+     * in a `MemoryMap` of each address space, detecting overlap between pinned sections and 
+     * `.org` regions.
+     */
     template<IsaTraitModel IsaTraits, AddressResolverTraitModel<IsaTraits> AddrTraits>
     class AddressResolver
     {
         AddrTraits traitObj_;
 
-        typename IsaTraits::AddressType codeAddressOffset_;
-        typename IsaTraits::AddressType dataAddressOffset_;
+        std::vector<Section<IsaTraits>> sections_;
+        std::size_t codeSection_;
+        std::size_t dataSection_;
+        /// @brief Section last selected or advanced by code or data, target of `.org`, `.align`, `.fill`, `.zero`.
+        std::size_t lastSelected_;
+
+        MemoryMap codeMap_;
+        MemoryMap dataMap_;
+
+        /// @brief Number of addressable units in each address space.
+        static constexpr std::size_t ADDRESS_SPACE_SIZE = 
+            std::size_t(std::numeric_limits<typename IsaTraits::AddressType>::max()) + 1;
+
+        inline static void advance_(Section<IsaTraits>& section, std::size_t size)
+        {
+            if(size > ADDRESS_SPACE_SIZE - 1 - std::size_t(section.offset))
+                throw std::out_of_range("Address space overflow in section " + section.name);
+
+            section.offset += static_cast<typename IsaTraits::AddressType>(size);
+        }
+
+        /// @brief Reserve count units of value at end of section, merging with previous run of same value.
+        inline static void fill_(Section<IsaTraits>& section, std::size_t count, typename IsaTraits::LargestType value)
+        {
+            if(count == 0)
+                return;
+
+            std::size_t offset = section.offset;
+            advance_(section, count);
+
+            if(!section.occupiesImage())
+                return;
+
+            if(!section.fills.empty()
+                && (section.fills.back().offset + section.fills.back().count == offset)
+                && (section.fills.back().value == value))
+                section.fills.back().count += count;
+            else
+                section.fills.push_back({offset, count, value});
+        }
+
+        inline std::vector<FillRegion<IsaTraits>> fills_(bool isCode) const
+        {
+            std::vector<FillRegion<IsaTraits>> fills;
+
+            for(const auto& section : sections_)
+                if(section.isCode() == isCode)
+                    for(const auto& region : section.fills)
+                        fills.push_back({section.baseAddress + region.offset, region.count, region.value});
+
+            std::ranges::sort(fills, {}, &FillRegion<IsaTraits>::offset);
+            return fills;
+        }
+
+        inline static std::size_t alignUp_(std::size_t address, typename IsaTraits::AddressType alignment) noexcept
+        {
+            return ((address + alignment - 1) / alignment) * alignment;
+        }
+
+        inline std::size_t spaceSize_(bool isCode) const noexcept
+        {
+            std::size_t size = 0;
+
+            for(const auto& section : sections_)
+                if(section.isCode() == isCode)
+                    size = std::max<std::size_t>(size, std::size_t(section.baseAddress) + section.offset);
+
+            return size;
+        }
 
     public:
         
+        /// @brief Construct traits from args, constrained so copies of resolver use copy constructor.
         template<class... Args>
-        inline AddressResolver(Args&&... args) noexcept 
+            requires std::constructible_from<AddrTraits, Args&&...>
+        inline AddressResolver(Args&&... args) 
             : traitObj_(std::forward<Args&&>(args)...), 
-            codeAddressOffset_(0), dataAddressOffset_(0) {}
+            sections_({
+                {std::string(literal::TEXT_SECTION), SectionKind::CODE, 1, 0, 0, false, {}},
+                {std::string(literal::DATA_SECTION), SectionKind::DATA, 1, 0, 0, false, {}},
+                {std::string(literal::VECTORS_SECTION), SectionKind::CODE, 1, 0, 0, false, {}},
+                {std::string(literal::RODATA_SECTION), SectionKind::READ_ONLY, 1, 0, 0, false, {}},
+                {std::string(literal::BSS_SECTION), SectionKind::ZERO, 1, 0, 0, false, {}}
+            }), 
+            codeSection_(0), dataSection_(1), lastSelected_(0), 
+            codeMap_(ADDRESS_SPACE_SIZE), dataMap_(ADDRESS_SPACE_SIZE) {}
 
         inline typename IsaTraits::AddressType getCodeAddressOffset() const noexcept 
         {
-            return codeAddressOffset_;
+            return sections_[codeSection_].offset;
         }
 
         inline typename IsaTraits::AddressType getDataAddressOffset() const noexcept 
         {
-            return dataAddressOffset_;
+            return sections_[dataSection_].offset;
+        }
+
+        inline std::size_t getCodeSection() const noexcept { return codeSection_; }
+        inline std::size_t getDataSection() const noexcept { return dataSection_; }
+
+        inline std::size_t sectionCount() const noexcept { return sections_.size(); }
+        inline const Section<IsaTraits>& getSection(std::size_t i) const { return sections_.at(i); }
+
+        inline typename IsaTraits::AddressType getSectionBase(std::size_t i) const noexcept 
+        { 
+            return sections_[i].baseAddress; 
+        }
+
+        /// @brief Index of section, `sectionCount()` if not found.
+        inline std::size_t findSection(std::string_view name) const noexcept
+        {
+            for(std::size_t i = 0; i < sections_.size(); ++i)
+                if(sections_[i].name == name)
+                    return i;
+
+            return sections_.size();
+        }
+
+        /**
+         * @brief Add new section.
+         * 
+         * @throw `std::domain_error` : Section already exists.
+         * @throw `std::invalid_argument` : Alignment is not a power of two.
+         */
+        inline std::size_t addSection(
+            std::string_view name, 
+            SectionKind kind, 
+            typename IsaTraits::AddressType alignment = 1
+        )
+        {
+            if(findSection(name) != sections_.size())
+                throw std::domain_error("Section already exists");
+
+            if(!easyMath::isPowerOfTwo(alignment))
+                throw std::invalid_argument("Section alignment must be a power of two");
+
+            sections_.push_back({std::string(name), kind, alignment, 0, 0, false, {}});
+            return sections_.size() - 1;
+        }
+
+        /**
+         * @brief Make section current code or data section, according to its kind.
+         * 
+         * @throw `std::invalid_argument` : Unknown section.
+         */
+        inline void selectSection(std::string_view name)
+        {
+            auto i = findSection(name);
+
+            if(i == sections_.size())
+                throw std::invalid_argument("Unknown section");
+
+            (sections_[i].isCode() ? codeSection_ : dataSection_) = i;
+            lastSelected_ = i;
+        }
+
+        /**
+         * @brief Continue last selected section at address relative to unit base, as a new pinned section.
+         * 
+         * New section is named `<section>@<address>` and has kind of last selected section. 
+         * Like every section, it is moved with the unit by its base address, and counts 
+         * towards extent of unit, so units placed after it start past it. For a single unit 
+         * at base 0, address is absolute.
+         * 
+         * @throw `std::out_of_range` : Address outside address space.
+         * @throw `std::domain_error` : Section already placed at address.
+         */
+        inline void org(std::size_t address)
+        {
+            if(address >= ADDRESS_SPACE_SIZE)
+                throw std::out_of_range("Origin outside address space");
+
+            const auto& current = sections_[lastSelected_].name;
+            auto name = current.substr(0, current.find('@')) + "@" + std::to_string(address);
+            addSection(name, sections_[lastSelected_].kind);
+            setSectionBase(name, static_cast<typename IsaTraits::AddressType>(address));
+            selectSection(name);
+        }
+
+        /**
+         * @brief Pad last selected section with zeros up to a multiple of alignment, and align 
+         * its base to at least as much.
+         * 
+         * Sections pinned by `setSectionBase` or `.org` are padded to a multiple of address relative to unit base instead.
+         * Alignments are powers of two, so the larger of two alignments is a multiple of both.
+         * 
+         * @throw `std::invalid_argument` : Alignment is not a power of two.
+         * @throw `std::out_of_range` : Alignment outside address space, or section overflows address space.
+         */
+        inline void align(std::size_t alignment)
+        {
+            auto& section = sections_[lastSelected_];
+            std::size_t position = section.offset + (section.isPinned ? section.baseAddress : 0);
+
+            if(!easyMath::isPowerOfTwo(alignment))
+                throw std::invalid_argument("Alignment must be a power of two");
+
+            if(alignment >= ADDRESS_SPACE_SIZE)
+                throw std::out_of_range("Alignment outside address space");
+
+            if(!section.isPinned)
+                section.alignment = std::max(section.alignment, static_cast<typename IsaTraits::AddressType>(alignment));
+
+            fill_(section, alignUp_(position, static_cast<typename IsaTraits::AddressType>(alignment)) - position, 0);
+        }
+
+        /**
+         * @brief Reserve count basic units of value in last selected section, without expanding them.
+         * 
+         * @throw `std::invalid_argument` : Non-zero value in zero initialised section.
+         * @throw `std::out_of_range` : Section overflows address space.
+         */
+        inline void fill(std::size_t count, typename IsaTraits::LargestType value)
+        {
+            auto& section = sections_[lastSelected_];
+
+            if(!section.occupiesImage() && (value != 0))
+                throw std::invalid_argument("Zero initialised section may not hold initial values");
+
+            fill_(section, count, value);
+        }
+
+        /**
+         * @brief Fill regions of code address space at addresses of last `layoutSections`, 
+         * ordered by address. Zero initialised sections have none.
+         */
+        inline std::vector<FillRegion<IsaTraits>> getCodeFills() const { return fills_(true); }
+
+        /**
+         * @brief Fill regions of image part of data address space at addresses of last 
+         * `layoutSections`, ordered by address. Zero initialised sections have none, being left 
+         * to be cleared at load like any `.bss`.
+         */
+        inline std::vector<FillRegion<IsaTraits>> getDataFills() const { return fills_(false); }
+
+        /**
+         * @brief Fix base address of section, relative to unit base of its address space.
+         * 
+         * @throw `std::invalid_argument` : Unknown section.
+         */
+        inline void setSectionBase(std::string_view name, typename IsaTraits::AddressType base)
+        {
+            auto i = findSection(name);
+
+            if(i == sections_.size())
+                throw std::invalid_argument("Unknown section");
+
+            sections_[i].baseAddress = base;
+            sections_[i].isPinned = true;
+        }
+
+        /**
+         * @brief Set size of code section laid out again, by `relaxCodeSection`.
+         * 
+         * @throw `std::invalid_argument` : Unknown section, or section is not code.
+         * @throw `std::domain_error` : Section has fill regions, whose offsets would not follow its contents.
+         * @throw `std::out_of_range` : Size outside address space.
+         */
+        inline void resizeSection(std::size_t i, std::size_t size)
+        {
+            if((i >= sections_.size()) || !sections_[i].isCode())
+                throw std::invalid_argument("Unknown code section");
+
+            if(!sections_[i].fills.empty())
+                throw std::domain_error("Section with fill regions may not be resized");
+
+            if(size >= ADDRESS_SPACE_SIZE)
+                throw std::out_of_range("Address space overflow in section " + sections_[i].name);
+
+            sections_[i].offset = static_cast<typename IsaTraits::AddressType>(size);
+        }
+
+        /**
+         * @brief Place pinned sections, then others one after another, aligned, in order of declaration, 
+         * skipping over pinned sections.
+         * 
+         * Rebuilds memory maps of code and data address space.
+         * 
+         * @throw `std::domain_error` : Pinned sections overlap.
+         * @throw `std::out_of_range` : Section wraps past end of address space.
+         */
+        inline void layoutSections()
+        {
+            codeMap_ = MemoryMap(ADDRESS_SPACE_SIZE);
+            dataMap_ = MemoryMap(ADDRESS_SPACE_SIZE);
+
+            for(const auto& section : sections_)
+                if(section.isPinned)
+                    (section.isCode() ? codeMap_ : dataMap_).place(section.baseAddress, section.offset, section.name);
+
+            std::size_t code = 0;
+            std::size_t data = 0;
+
+            for(auto& section : sections_)
+            {
+                if(section.isPinned)
+                    continue;
+
+                auto& cursor = section.isCode() ? code : data;
+                auto& map = section.isCode() ? codeMap_ : dataMap_;
+                auto base = alignUp_(cursor, section.alignment);
+
+                while(auto overlap = map.findOverlap(base, section.offset))
+                    base = alignUp_(overlap->end, section.alignment);
+
+                map.place(base, section.offset, section.name);
+
+                section.baseAddress = static_cast<typename IsaTraits::AddressType>(base);
+                cursor = base + section.offset;
+            }
         }
 
+        /// @brief Sections of code address space placed by last `layoutSections`.
+        inline const MemoryMap& getCodeMap() const noexcept { return codeMap_; }
+
+        /// @brief Sections of data address space placed by last `layoutSections`.
+        inline const MemoryMap& getDataMap() const noexcept { return dataMap_; }
+
+        /// @brief Extent of code address space used by unit.
+        inline std::size_t getCodeSize() const noexcept { return spaceSize_(true); }
+
+        /// @brief Extent of data address space used by unit.
+        inline std::size_t getDataSize() const noexcept { return spaceSize_(false); }
+
+        /// @brief Size of unit in image, excluding zero initialised sections.
+        inline std::size_t getImageSize() const noexcept
+        {
+            std::size_t size = 0;
+
+            for(const auto& section : sections_)
+                if(section.occupiesImage())
+                    size += section.offset;
+
+            return size;
+        }
+
+        /**
+         * @brief Advance current data section by size of all elements of data symbol, and make it last selected section.
+         * 
+         * @throw `std::invalid_argument` : Non-zero initial value in zero initialised section.
+         * @throw `std::out_of_range` : Section overflows address space.
+         */
         inline void updateOffsets(const SymbolToken<IsaTraits>& symbol)
         {
-            if(symbol.symbolType == SymbolType::DATA)
-                dataAddressOffset_ += 
-                    traitObj_.getSizeInBasic(symbol.blockSizeCode) 
-                    * symbol.init_value.size();
+            if(symbol.symbolType != SymbolType::DATA)
+                return;
+
+            auto& section = sections_[dataSection_];
+            lastSelected_ = dataSection_;
+
+            if(!section.occupiesImage() && std::ranges::any_of(symbol.init_value, [](auto value) { return value != 0; }))
+                throw std::invalid_argument("Zero initialised section may not hold initial values");
+
+            auto width = traitObj_.getSizeInBasic(symbol.blockSizeCode);
+
+            if((width != 0) && (symbol.elementCount > ADDRESS_SPACE_SIZE / width))
+                throw std::out_of_range("Address space overflow in section " + section.name);
+
+            advance_(section, width * symbol.elementCount);
         }
 
+        /// @throw `std::out_of_range` : Section overflows address space.
         inline void updateOffsets(const InstructionToken<IsaTraits>& instr)
         {
-            codeAddressOffset_ += traitObj_.getInstrWidthInBasic(instr.opCode);
+            lastSelected_ = codeSection_;
+            advance_(sections_[codeSection_], traitObj_.getInstrWidthInBasic(instr.opCode));
+        }
+
+        /**
+         * @brief Advance current code section by total width of instructions with op codes, 
+         * as a single checked step.
+         * 
+         * @throw `std::out_of_range` : Section overflows address space.
+         */
+        inline void updateCodeOffsets(std::span<const typename IsaTraits::OpCodeType> opCodes)
+        {
+            lastSelected_ = codeSection_;
+            advance_(sections_[codeSection_], sumInstrWidths<IsaTraits>(traitObj_, opCodes));
+        }
+
+        /// @throw see `selectSection`, `org`, `align`, `fill`.
+        inline void updateOffsets(const DirectiveToken<IsaTraits>& directive)
+        {
+            switch (directive.directiveType)
+            {
+            case DirectiveType::SECTION:
+                selectSection(directive.name);
+                break;
+            case DirectiveType::ORG:
+                org(directive.values[0]);
+                break;
+            case DirectiveType::ALIGN:
+                align(directive.values[0]);
+                break;
+            case DirectiveType::FILL:
+                fill(directive.values[0], directive.values[1]);
+                break;
+            case DirectiveType::ZERO:
+                fill(directive.values[0], 0);
+                break;
+            }
         }
     };
 
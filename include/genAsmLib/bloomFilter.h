@@ -0,0 +1,109 @@
+/**
+ * @file bloomFilter.h 
+ * @author Harith Manoj (harithpub@gmail.com)
+ * @brief Bloom filter of symbol names.
+ * @date 17 October 2026
+ * 
+ * @copyright Copyright (C) 2024
+ * 
+ * 
+ *                      APACHE LICENSE 2.0
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * 
+ */
+
+
+#ifndef INCLUDE_GENASMLIB_BLOOMFILTER_H_INCLUDED
+
+/// @brief include\genAsmLib\bloomFilter.h Header Guard 
+#define INCLUDE_GENASMLIB_BLOOMFILTER_H_INCLUDED
+
+#include <vector>
+#include <cstdint>
+#include <string_view>
+#include <functional>
+#include <bit>
+#include <algorithm>
+
+namespace gen_asm
+{
+    namespace literal
+    {
+        /// @brief Bits in Bloom filter of each translation unit.
+        constexpr std::size_t UNIT_BLOOM_BITS = 2048;
+
+        /// @brief Bits in Bloom filter of all translation units.
+        constexpr std::size_t GLOBAL_BLOOM_BITS = std::size_t(1) << 16;
+
+        /// @brief Number of bits set per name in Bloom filter.
+        constexpr std::size_t BLOOM_HASH_COUNT = 4;
+    }
+
+    /**
+     * @brief Bloom filter of names, answers "definitely absent" or "maybe present".
+     * 
+     * Bit positions are derived from one `std::hash` of the name by double hashing, 
+     * so callers checking several filters hash the name once.
+     */
+    class BloomFilter
+    {
+        std::vector<std::uint64_t> words_;
+        std::size_t mask_;
+
+        template<class Op>
+        inline bool forEachBit_(std::size_t hash, Op op) const
+        {
+            std::size_t step = std::rotl(hash, 32) | 1;
+
+            for(std::size_t i = 0; i < literal::BLOOM_HASH_COUNT; ++i, hash += step)
+            {
+                auto bit = hash & mask_;
+                if(!op(bit >> 6, std::uint64_t(1) << (bit & 63)))
+                    return false;
+            }
+
+            return true;
+        }
+
+    public:
+
+        /// @param[in] bits number of bits, rounded up to power of 2 and at least 64.
+        inline BloomFilter(std::size_t bits = literal::UNIT_BLOOM_BITS) 
+            : words_(std::bit_ceil(std::max<std::size_t>(bits, 64)) / 64, 0), mask_(words_.size() * 64 - 1) {}
+
+        inline static std::size_t hash(std::string_view name) noexcept { return std::hash<std::string_view>{}(name); }
+
+        inline void add(std::size_t hash) noexcept
+        {
+            forEachBit_(hash, [this](std::size_t word, std::uint64_t bit) { words_[word] |= bit; return true; });
+        }
+
+        inline void add(std::string_view name) noexcept { add(hash(name)); }
+
+        inline bool mayContain(std::size_t hash) const noexcept
+        {
+            return forEachBit_(hash, [this](std::size_t word, std::uint64_t bit) { return (words_[word] & bit) != 0; });
+        }
+
+        inline bool mayContain(std::string_view name) const noexcept { return mayContain(hash(name)); }
+
+        inline void clear() noexcept { std::ranges::fill(words_, 0); }
+
+        inline std::size_t sizeInBytes() const noexcept { return words_.size() * sizeof(std::uint64_t); }
+    };
+}
+
+
+#endif // INCLUDE_GENASMLIB_BLOOMFILTER_H_INCLUDED
+
@@ -24,9 +24,19 @@
  */
 
 
+#ifndef INCLUDE_GENASMLIB_CODEDINSTRUCTION_H_INCLUDED
+
+/// @brief include\genAsmLib\codedInstruction.h Header Guard 
+#define INCLUDE_GENASMLIB_CODEDINSTRUCTION_H_INCLUDED
+
+
 #include <bitset>
 #include <array>
 #include <ranges>
+#include <span>
+#include <cstdint>
+#include <utility>
+#include <stdexcept>
 
 #include <easyMathLib/easyMath.h>
 
@@ -87,4 +97,155 @@ namespace gen_asm
         
         const std::bitset<widthMax>& data() const noexcept { return data_; }
     };
+
+    /// @brief Operand field of an encoded word, signed fields hold two's complement values.
+    struct EncodingField
+    {
+        std::size_t offset;
+        std::size_t size;
+        bool isSigned;
+    };
+
+    /**
+     * @brief Compile time encoding of one op code, a base word with op code bits set and 
+     * operand fields in operand order.
+     * 
+     * Encoding is a mask, shift and or per field. Range of every operand follows from size of its field.
+     * 
+     * @tparam WordType Type of encoded word.
+     * @tparam baseWord Word with op code and other fixed bits set, operand fields clear.
+     * @tparam fields Operand fields, in order of operands.
+     */
+    template<easyMath::UnsignedIntegral WordType, WordType baseWord, EncodingField... fields>
+    struct EncodingTemplate
+    {
+        static constexpr WordType base = baseWord;
+        static constexpr std::size_t fieldCount = sizeof...(fields);
+        static constexpr std::array<EncodingField, sizeof...(fields)> fieldList = { fields... };
+
+        static_assert(((fields.offset + fields.size <= sizeof(WordType) * 8) && ...), "Field outside word");
+        static_assert((((base & (easyMath::nBitMask<WordType>(fields.size) << fields.offset)) == 0) && ...), 
+            "Base word sets bits of a field");
+
+        /// @brief Check if value, read as signed for signed fields, fits field.
+        static constexpr bool fits(EncodingField field, std::uint64_t value) noexcept
+        {
+            if(field.isSigned)
+            {
+                auto signedValue = static_cast<std::int64_t>(value);
+                auto limit = std::int64_t(1) << (field.size - 1);
+                return (signedValue >= -limit) && (signedValue < limit);
+            }
+
+            return value <= easyMath::nBitMask<std::uint64_t>(field.size);
+        }
+
+        /**
+         * @brief Encode operand values into base word.
+         * 
+         * @throw `std::out_of_range` : Value does not fit its field.
+         */
+        template<std::convertible_to<std::uint64_t>... Values>
+            requires (sizeof...(Values) == sizeof...(fields))
+        static constexpr WordType encode(Values... values)
+        {
+            if(!(fits(fields, static_cast<std::uint64_t>(values)) && ...))
+                throw std::out_of_range("Operand does not fit its field");
+
+            return static_cast<WordType>(base | ((
+                (static_cast<WordType>(values) & easyMath::nBitMask<WordType>(fields.size)) << fields.offset
+            ) | ... | WordType(0)));
+        }
+
+        /**
+         * @brief Encode operand values held in span, in operand order.
+         * 
+         * @throw `std::invalid_argument` : Number of values is not number of fields.
+         * @throw `std::out_of_range` : Value does not fit its field.
+         */
+        static constexpr WordType encode(std::span<const std::uint64_t> values)
+        {
+            if(values.size() != fieldCount)
+                throw std::invalid_argument("Number of operands does not match encoding");
+
+            return [&]<std::size_t... i>(std::index_sequence<i...>)
+            {
+                return encode(values[i]...);
+            }(std::make_index_sequence<fieldCount>());
+        }
+
+        /**
+         * @brief Extract operand fields of word in operand order, sign extending signed fields, inverse of `encode`.
+         * 
+         * @param[out] values At least `fieldCount` values.
+         * @return number of operands.
+         */
+        static constexpr std::size_t decode(WordType word, std::span<std::uint64_t> values) noexcept
+        {
+            for(std::size_t i = 0; i < fieldCount; ++i)
+            {
+                auto mask = easyMath::nBitMask<std::uint64_t>(fieldList[i].size);
+                auto value = (std::uint64_t(word) >> fieldList[i].offset) & mask;
+
+                if(fieldList[i].isSigned && ((value >> (fieldList[i].size - 1)) != 0))
+                    value |= ~mask;
+
+                values[i] = value;
+            }
+
+            return fieldCount;
+        }
+    };
+
+    /// @brief Op code and field decoder of one value of op code bits, no decoder if value encodes no instruction.
+    template<easyMath::UnsignedIntegral WordType>
+    struct DecoderEntry
+    {
+        std::size_t opCode;
+        std::size_t (*decode)(WordType, std::span<std::uint64_t>) noexcept;
+    };
+
+    /**
+     * @brief Table of span encoders of `Encoding<0>` to `Encoding<count - 1>`, to encode op codes known only at run time.
+     * 
+     * @tparam Encoding Template specialised to an `EncodingTemplate` for each op code.
+     */
+    template<easyMath::UnsignedIntegral WordType, template<std::size_t> class Encoding, std::size_t count>
+    constexpr auto makeEncoderTable() noexcept
+    {
+        return []<std::size_t... op>(std::index_sequence<op...>)
+        {
+            return std::array<WordType (*)(std::span<const std::uint64_t>), count>{ 
+                static_cast<WordType (*)(std::span<const std::uint64_t>)>(&Encoding<op>::encode)... 
+            };
+        }(std::make_index_sequence<count>());
+    }
+
+    /**
+     * @brief Table of decoders of `Encoding<0>` to `Encoding<count - 1>`, indexed by op code bits of their base word.
+     * 
+     * @tparam opCodeOffset Offset of op code bits in word.
+     * @tparam opCodeBits Number of op code bits.
+     */
+    template<
+        easyMath::UnsignedIntegral WordType, 
+        template<std::size_t> class Encoding, 
+        std::size_t count, 
+        std::size_t opCodeOffset, 
+        std::size_t opCodeBits
+    >
+    constexpr auto makeDecoderTable() noexcept
+    {
+        std::array<DecoderEntry<WordType>, std::size_t(1) << opCodeBits> table{};
+
+        [&]<std::size_t... op>(std::index_sequence<op...>)
+        {
+            ((table[(Encoding<op>::base >> opCodeOffset) & easyMath::nBitMask<std::size_t>(opCodeBits)] = {op, &Encoding<op>::decode}), ...);
+        }(std::make_index_sequence<count>());
+
+        return table;
+    }
 }
+
+
+#endif // INCLUDE_GENASMLIB_CODEDINSTRUCTION_H_INCLUDED
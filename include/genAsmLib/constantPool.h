@@ -0,0 +1,121 @@
+/**
+ * @file constantPool.h 
+ * @author Harith Manoj (harithpub@gmail.com)
+ * @brief Deduplicating pool of constant values.
+ * @date 17 October 2026
+ * 
+ * @copyright Copyright (C) 2024
+ * 
+ * 
+ *                      APACHE LICENSE 2.0
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * 
+ */
+
+
+#ifndef INCLUDE_GENASMLIB_CONSTANTPOOL_H_INCLUDED
+
+/// @brief include\genAsmLib\constantPool.h Header Guard 
+#define INCLUDE_GENASMLIB_CONSTANTPOOL_H_INCLUDED
+
+#include <span>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+
+#include <easyMathLib/easyMath.h>
+
+namespace gen_asm
+{
+    /// @brief Slice of `ConstantPool`.
+    struct ConstantSlice
+    {
+        std::size_t offset;
+        std::size_t count;
+
+        inline bool operator == (const ConstantSlice&) const noexcept = default;
+    };
+
+    /**
+     * @brief Content addressed pool of constant tables.
+     * 
+     * Identical tables are stored once, every intern of same contents returns same slice.
+     * 
+     * @tparam ValueType type of element of tables.
+     */
+    template<easyMath::UnsignedIntegral ValueType>
+    class ConstantPool
+    {
+        std::vector<ValueType> values_;
+        std::vector<ConstantSlice> slices_;
+        std::unordered_multimap<std::size_t, std::size_t> index_;
+
+        inline static std::size_t hash_(std::span<const ValueType> values) noexcept
+        {
+            std::size_t hash = values.size();
+            for(auto value : values)
+                hash ^= std::hash<ValueType>{}(value) + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2);
+            return hash;
+        }
+
+    public:
+
+        inline ConstantPool() : values_(), slices_(), index_() {}
+
+        /**
+         * @brief Get slice holding values, adding them to pool if no identical table exists.
+         * 
+         * @param[in] values contents of table.
+         * @return slice of pool equal to values.
+         */
+        inline ConstantSlice intern(std::span<const ValueType> values)
+        {
+            auto hash = hash_(values);
+            auto [first, last] = index_.equal_range(hash);
+
+            for(auto i = first; i != last; ++i)
+            {
+                const auto& slice = slices_[i->second];
+                if(std::ranges::equal(get(slice), values))
+                    return slice;
+            }
+
+            ConstantSlice slice = {values_.size(), values.size()};
+            values_.insert(values_.end(), values.begin(), values.end());
+            slices_.push_back(slice);
+            index_.emplace(hash, slices_.size() - 1);
+
+            return slice;
+        }
+
+        inline std::span<const ValueType> get(const ConstantSlice& slice) const noexcept
+        {
+            return std::span(values_).subspan(slice.offset, slice.count);
+        }
+
+        inline const ValueType& operator [] (std::size_t i) const noexcept { return values_[i]; }
+
+        /// @brief Every unique table, concatenated.
+        inline std::span<const ValueType> values() const noexcept { return values_; }
+
+        /// @brief Every unique table in order of first intern, for emitters writing each table once.
+        inline std::span<const ConstantSlice> slices() const noexcept { return slices_; }
+
+        inline std::size_t size() const noexcept { return values_.size(); }
+    };
+}
+
+
+#endif // INCLUDE_GENASMLIB_CONSTANTPOOL_H_INCLUDED
+
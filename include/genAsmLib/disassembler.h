@@ -0,0 +1,244 @@
+/**
+ * @file disassembler.h 
+ * @author Harith Manoj (harithpub@gmail.com)
+ * @brief Table driven decoding of encoded words.
+ * @date 17 October 2026
+ * 
+ * @copyright Copyright (C) 2024
+ * 
+ * 
+ *                      APACHE LICENSE 2.0
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * 
+ */
+
+
+#ifndef INCLUDE_GENASMLIB_DISASSEMBLER_H_INCLUDED
+
+/// @brief include\genAsmLib\disassembler.h Header Guard 
+#define INCLUDE_GENASMLIB_DISASSEMBLER_H_INCLUDED
+
+#include <array>
+#include <span>
+#include <string>
+#include <vector>
+#include <variant>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "tokeniser.h"
+#include "codedInstruction.h"
+
+namespace gen_asm
+{
+    /**
+     * @brief Check if type can decode words of an ISA.
+     * 
+     * Must Have:
+     * 
+     * @conceptMember{Constants}
+     * - `static constexpr decoderTable`
+     *      - `DecoderEntry<IsaTraits::WordType>` for every value of op code bits, see `makeDecoderTable`.
+     * - `static constexpr std::size_t decoderShift`
+     *      - Offset of op code bits in word.
+     * 
+     * @conceptMember{Methods}
+     * - `[std::string_view] instrString(IsaTraits::OpCodeType)`
+     *      - Name of op code.
+     * - `const OperandPattern& getOperandPattern(IsaTraits::OpCodeType)`
+     *      - Operand kinds of op code, in order of its fields.
+     * - `[bool] isPcRelative(IsaTraits::OpCodeType) noexcept`
+     *      - Whether immediate of op code is a displacement from the next instruction.
+     */
+    template<class Traits, class IsaTraits>
+    concept DisassemblerTraitModel = requires(
+        const Traits& trait, 
+        const typename IsaTraits::OpCodeType& op
+    )
+    {
+        requires IsaTraitModel<IsaTraits>;
+        requires OperandPatternTraitModel<Traits, IsaTraits>;
+
+        { Traits::decoderTable[std::size_t{}] } -> std::convertible_to<DecoderEntry<typename IsaTraits::WordType>>;
+        { Traits::decoderShift } -> std::convertible_to<std::size_t>;
+
+        { trait.instrString(op) } -> std::convertible_to<std::string_view>;
+        { trait.isPcRelative(op) } -> std::convertible_to<bool>;
+    };
+
+    /// @brief Decoded instruction, operand values as held in their fields, signed fields sign extended.
+    template<IsaTraitModel IsaTraits>
+    struct DecodedInstruction
+    {
+        typename IsaTraits::OpCodeType opCode;
+        std::size_t operandCount;
+        std::array<std::uint64_t, literal::MAX_OPERAND_COUNT> operands;
+    };
+
+    /**
+     * @brief Decode words through a table indexed by op code bits, into `DecodedInstruction`, 
+     * `InstructionToken` or text listings.
+     * 
+     * Decoding a word is one table lookup and the shifts and masks of its fields, 
+     * allocating nothing. Listings name branch targets and label addresses after jump 
+     * symbols loaded by `loadSymbols`.
+     * 
+     * @tparam IsaTraits All ISA types.
+     * @tparam Traits Decoder traits, must satisfy DisassemblerTraitModel.
+     */
+    template<IsaTraitModel IsaTraits, DisassemblerTraitModel<IsaTraits> Traits>
+    class Disassembler
+    {
+        Traits traitObj_;
+
+        /// @brief Name of jump symbol at every absolute code address known.
+        std::unordered_map<std::size_t, std::string> labels_;
+
+        inline const std::string* label_(std::size_t address) const
+        {
+            auto it = labels_.find(address);
+            return (it == labels_.end()) ? nullptr : &it->second;
+        }
+
+    public:
+
+        template<class... Args>
+        inline Disassembler(Args&&... args) : traitObj_(std::forward<Args&&>(args)...), labels_() {}
+
+        /**
+         * @brief Decode word.
+         * 
+         * @throw `std::domain_error` : Op code bits encode no instruction.
+         */
+        inline DecodedInstruction<IsaTraits> decode(typename IsaTraits::WordType word) const
+        {
+            const auto& entry = Traits::decoderTable[(word >> Traits::decoderShift) & (Traits::decoderTable.size() - 1)];
+
+            if(entry.decode == nullptr)
+                throw std::domain_error("Undefined op code");
+
+            DecodedInstruction<IsaTraits> decoded{static_cast<typename IsaTraits::OpCodeType>(entry.opCode), 0, {}};
+            decoded.operandCount = entry.decode(word, decoded.operands);
+            return decoded;
+        }
+
+        /// @throw see `decode`.
+        inline std::vector<DecodedInstruction<IsaTraits>> decode(std::span<const typename IsaTraits::WordType> words) const
+        {
+            std::vector<DecodedInstruction<IsaTraits>> decoded;
+            decoded.reserve(words.size());
+
+            for(auto word : words)
+                decoded.push_back(decode(word));
+
+            return decoded;
+        }
+
+        /// @brief Token of decoded instruction, every operand resolved in its fixed operands, as tokenized by operand pattern.
+        inline InstructionToken<IsaTraits> toToken(const DecodedInstruction<IsaTraits>& decoded) const
+        {
+            InstructionToken<IsaTraits> token{};
+            token.opCode = decoded.opCode;
+            token.operands.count = decoded.operandCount;
+
+            for(std::size_t i = 0; i < decoded.operandCount; ++i)
+                token.operands.set(i, decoded.operands[i]);
+
+            return token;
+        }
+
+        /**
+         * @brief Name addresses after jump symbols of table, at code addresses of its last layout.
+         * 
+         * Later symbols at an address already named are ignored.
+         */
+        template<class SymbolTable>
+        inline void loadSymbols(const SymbolTable& table)
+        {
+            auto codeBase = table.getBaseAddress().first;
+
+            for(const auto& record : table)
+                if(const auto* symbol = std::get_if<0>(&record))
+                    labels_.try_emplace(codeBase + symbol->codeAddressOffset, symbol->symbolName);
+        }
+
+        inline void clearSymbols() noexcept { labels_.clear(); }
+
+        /**
+         * @brief Text of decoded instruction at address, as accepted by tokenizer (`beq %r1, %r2, $-3`).
+         * 
+         * Displacements of pc relative op codes are replaced by the name of their target, if known.
+         */
+        inline std::string format(const DecodedInstruction<IsaTraits>& decoded, std::size_t address) const
+        {
+            std::string text(traitObj_.instrString(decoded.opCode));
+            const auto& pattern = traitObj_.getOperandPattern(decoded.opCode);
+
+            for(std::size_t i = 0; i < decoded.operandCount; ++i)
+            {
+                text += (i == 0) ? " " : ", ";
+
+                auto value = decoded.operands[i];
+
+                if(pattern[i] == OperandKind::REGISTER)
+                {
+                    text += "%r";
+                    text += std::to_string(value);
+                    continue;
+                }
+
+                if(traitObj_.isPcRelative(decoded.opCode))
+                {
+                    auto target = static_cast<typename IsaTraits::AddressType>(address + 1 + value);
+                    if(const auto* name = label_(target))
+                    {
+                        text += *name;
+                        continue;
+                    }
+                }
+
+                text += "$";
+                text += std::to_string(static_cast<std::int64_t>(value));
+            }
+
+            return text;
+        }
+
+        /**
+         * @brief Listing of words starting at address, one instruction per line, 
+         * preceded by `name:` lines of labels at its address.
+         * 
+         * @throw see `decode`.
+         */
+        inline std::string disassemble(std::span<const typename IsaTraits::WordType> words, std::size_t address = 0) const
+        {
+            std::string listing;
+
+            for(auto word : words)
+            {
+                if(const auto* name = label_(address))
+                    listing += *name + ":\n";
+
+                listing += format(decode(word), address);
+                listing += '\n';
+                ++address;
+            }
+
+            return listing;
+        }
+    };
+}
+
+
+#endif // INCLUDE_GENASMLIB_DISASSEMBLER_H_INCLUDED
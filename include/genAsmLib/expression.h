@@ -0,0 +1,618 @@
+/**
+ * @file expression.h 
+ * @author Harith Manoj (harithpub@gmail.com)
+ * @brief Assembly time constant expression compiler and evaluator.
+ * @date 17 October 2026
+ * 
+ * @copyright Copyright (C) 2024
+ * 
+ * 
+ *                      APACHE LICENSE 2.0
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * 
+ */
+
+
+#ifndef INCLUDE_GENASMLIB_EXPRESSION_H_INCLUDED
+
+/// @brief include\genAsmLib\expression.h Header Guard
+#define INCLUDE_GENASMLIB_EXPRESSION_H_INCLUDED
+
+#include <string_view>
+#include <cstdint>
+#include <vector>
+#include <string>
+#include <tuple>
+#include <array>
+#include <stdexcept>
+#include <algorithm>
+#include <type_traits>
+
+#include <easyParseLib/easyParse.h>
+#include <easyMathLib/easyMath.h>
+
+namespace gen_asm
+{
+
+    namespace literal
+    {
+        /// @brief Maximum evaluation stack depth of a compiled expression.
+        constexpr std::size_t MAX_EXPRESSION_DEPTH = 16;
+
+        /// @brief Characters which make an operand an expression rather than a plain symbol.
+        constexpr std::string_view EXPRESSION_OPERATORS = "+-*/%&|^~<>()";
+
+        /// @brief Largest number usable as a numeric local label.
+        constexpr std::size_t MAX_LOCAL_LABEL_NUMBER = 65535;
+
+        /// @brief Suffix of local label reference to next definition.
+        constexpr char LOCAL_FORWARD_SUFFIX = 'f';
+
+        /// @brief Suffix of local label reference to previous definition.
+        constexpr char LOCAL_BACKWARD_SUFFIX = 'b';
+    }
+
+    /// @brief Reference to numeric local label (`1f` or `1b`).
+    struct LocalLabelReference
+    {
+        /// @brief Number of label referred.
+        std::size_t number;
+
+        /// @brief Whether reference is to the next definition (`f`) or previous definition (`b`).
+        bool isForward;
+
+        /**
+         * @brief Index of definition referred, among definitions of `number` in translation unit in source order.
+         * 
+         * Filled by `Tokenizer`, which counts definitions of every unit.
+         */
+        std::size_t definition;
+    };
+
+    /**
+     * @brief Convert number of local label definition or reference.
+     * 
+     * @throw `std::invalid_argument` : Not a decimal number, or larger than `literal::MAX_LOCAL_LABEL_NUMBER`.
+     */
+    [[nodiscard]] inline std::size_t convertLocalLabelNumber(std::string_view number)
+    {
+        if(number.empty() || !easyParse::validateDecString(number) || (number.size() > 5))
+            throw std::invalid_argument("Invalid local label number");
+
+        auto value = easyParse::convertDecimalString<std::size_t>(number);
+
+        if(value > literal::MAX_LOCAL_LABEL_NUMBER)
+            throw std::invalid_argument("Local label number too large");
+
+        return value;
+    }
+
+    /// @brief Check if operand text is a local label reference, decimal digits followed by `f` or `b`.
+    [[nodiscard]] constexpr inline bool isLocalLabelOperand(std::string_view arg) noexcept
+    {
+        if((arg.size() < 2) || ((arg.back() != literal::LOCAL_FORWARD_SUFFIX) && (arg.back() != literal::LOCAL_BACKWARD_SUFFIX)))
+            return false;
+
+        return std::ranges::all_of(arg.substr(0, arg.size() - 1), [](char ch) { return (ch >= '0') && (ch <= '9'); });
+    }
+
+    /// @brief Operation of a single term of a postfix expression.
+    enum class ExpressionOp : std::uint8_t
+    {
+        /// @brief Push literal value.
+        LITERAL,
+
+        /// @brief Push value of symbol reference (value is index into symbol list).
+        SYMBOL,
+
+        /// @brief Push address of local label reference (value is index into local label list).
+        LOCAL_LABEL,
+
+        /// @brief Unary 2's complement negation.
+        NEGATE,
+
+        /// @brief Unary bitwise complement.
+        COMPLEMENT,
+
+        ADD,
+        SUBTRACT,
+        MULTIPLY,
+        DIVIDE,
+        MODULO,
+        SHIFT_LEFT,
+        SHIFT_RIGHT,
+        AND,
+        XOR,
+        OR
+    };
+
+    /**
+     * @brief Compiled assembly time expression in postfix form.
+     *
+     * Literal only sub-expressions are folded while compiling, symbol and local label references
+     * are stored once in `symbols` and `localLabels`, and referred to by index from `postfix`.
+     *
+     * Values are 2's complement: `/` and `%` divide as signed values truncating toward zero,
+     * `>>` shifts arithmetically. `MIN / -1` wraps to `MIN` and `MIN % -1` is 0.
+     *
+     * @tparam LargestType Type of values of the expression.
+     */
+    template<easyMath::UnsignedIntegral LargestType>
+    struct Expression
+    {
+        /// @brief Single postfix term, value is literal for `LITERAL` or index into `symbols` or `localLabels`.
+        struct Term
+        {
+            ExpressionOp op;
+            LargestType value;
+        };
+
+        /// @brief Terms in evaluation order.
+        std::vector<Term> postfix;
+
+        /// @brief Symbol references (name, primary index, secondary index) used in expression.
+        std::vector<std::tuple<std::string, std::size_t, std::size_t>> symbols;
+
+        /// @brief Local label references used in expression.
+        std::vector<LocalLabelReference> localLabels;
+
+        /// @brief Check if expression has no symbol or local label references (single folded literal).
+        inline bool isConstant() const noexcept { return symbols.empty() && localLabels.empty(); }
+
+        /**
+         * @brief Apply operator on values.
+         *
+         * @throw `std::domain_error` : Division or modulo by zero.
+         *
+         * @param[in] op operator to apply.
+         * @param[in] lhs left hand side value (only value for unary operators).
+         * @param[in] rhs right hand side value.
+         * @return LargestType result.
+         */
+        [[nodiscard]] static constexpr LargestType apply(ExpressionOp op, LargestType lhs, LargestType rhs = 0)
+        {
+            using SignedType = std::make_signed_t<LargestType>;
+
+            switch (op)
+            {
+            case ExpressionOp::NEGATE:      return ~lhs + 1;
+            case ExpressionOp::COMPLEMENT:  return ~lhs;
+            case ExpressionOp::ADD:         return lhs + rhs;
+            case ExpressionOp::SUBTRACT:    return lhs - rhs;
+            case ExpressionOp::MULTIPLY:    return lhs * rhs;
+            case ExpressionOp::DIVIDE:
+                if(rhs == 0)
+                    throw std::domain_error("Division by zero in expression");
+                if(rhs == LargestType(~LargestType(0)))
+                    return ~lhs + 1;
+                return static_cast<LargestType>(static_cast<SignedType>(lhs) / static_cast<SignedType>(rhs));
+            case ExpressionOp::MODULO:
+                if(rhs == 0)
+                    throw std::domain_error("Modulo by zero in expression");
+                if(rhs == LargestType(~LargestType(0)))
+                    return 0;
+                return static_cast<LargestType>(static_cast<SignedType>(lhs) % static_cast<SignedType>(rhs));
+            case ExpressionOp::SHIFT_LEFT:
+                return (rhs >= easyMath::bitSize<LargestType>()) ? 0 : (lhs << rhs);
+            case ExpressionOp::SHIFT_RIGHT:
+                if(rhs >= easyMath::bitSize<LargestType>())
+                    return (static_cast<SignedType>(lhs) < 0) ? LargestType(~LargestType(0)) : LargestType(0);
+                return static_cast<LargestType>(static_cast<SignedType>(lhs) >> rhs);
+            case ExpressionOp::AND:         return lhs & rhs;
+            case ExpressionOp::XOR:         return lhs ^ rhs;
+            case ExpressionOp::OR:          return lhs | rhs;
+            default:                        return lhs;
+            }
+        }
+
+        /**
+         * @brief Evaluate expression.
+         *
+         * @tparam SymbolResolver callable taking symbol reference tuple and returning its value.
+         * @tparam LocalLabelResolver callable taking `LocalLabelReference` and returning its address.
+         * @param[in] resolveSymbol symbol resolver.
+         * @param[in] resolveLocalLabel local label resolver.
+         * @return LargestType value of expression.
+         */
+        template<class SymbolResolver, class LocalLabelResolver>
+        [[nodiscard]] inline LargestType evaluate(SymbolResolver&& resolveSymbol, LocalLabelResolver&& resolveLocalLabel) const
+        {
+            std::array<LargestType, literal::MAX_EXPRESSION_DEPTH> stack;
+            std::size_t top = 0;
+
+            for(const auto& term : postfix)
+            {
+                switch (term.op)
+                {
+                case ExpressionOp::LITERAL:
+                    stack[top++] = term.value;
+                    break;
+                case ExpressionOp::SYMBOL:
+                    stack[top++] = static_cast<LargestType>(resolveSymbol(symbols[term.value]));
+                    break;
+                case ExpressionOp::LOCAL_LABEL:
+                    stack[top++] = static_cast<LargestType>(resolveLocalLabel(localLabels[term.value]));
+                    break;
+                case ExpressionOp::NEGATE: [[fallthrough]];
+                case ExpressionOp::COMPLEMENT:
+                    stack[top - 1] = apply(term.op, stack[top - 1]);
+                    break;
+                default:
+                    --top;
+                    stack[top - 1] = apply(term.op, stack[top - 1], stack[top]);
+                    break;
+                }
+            }
+
+            return stack[0];
+        }
+
+        /**
+         * @brief Evaluate expression without local label references.
+         *
+         * @throw `std::invalid_argument` : Expression refers to local label.
+         */
+        template<class SymbolResolver>
+        [[nodiscard]] inline LargestType evaluate(SymbolResolver&& resolveSymbol) const
+        {
+            return evaluate(
+                std::forward<SymbolResolver>(resolveSymbol), 
+                [](const LocalLabelReference&) -> LargestType
+                {
+                    throw std::invalid_argument("Local label in expression needs local label resolver");
+                }
+            );
+        }
+    };
+
+    namespace impl_detail_
+    {
+        /**
+         * @brief Parse whole string as number through `easyParse::parseNumber`, naming `what` in errors.
+         *
+         * @throw `std::out_of_range` : Number does not fit `Integer`.
+         * @throw `std::invalid_argument` : Not a number, or characters after it.
+         */
+        template<easyMath::UnsignedIntegral Integer>
+        [[nodiscard]] inline Integer parseWholeNumber_(std::string_view number, std::string_view what)
+        {
+            auto result = easyParse::parseNumber<Integer>(number);
+
+            if(result.ec == std::errc::result_out_of_range)
+                throw std::out_of_range(std::string(what) + " out of range");
+
+            if((result.ec != std::errc{}) || (result.ptr != number.data() + number.size()))
+                throw std::invalid_argument("Invalid " + std::string(what));
+
+            return result.value;
+        }
+
+        /**
+         * @brief Recursive descent compiler from infix text to postfix expression.
+         *
+         * Precedence (high to low): unary `- ~ +`, `* / %`, `+ -`, `<< >>`, `&`, `^`, `|`.
+         * Binary operators of equal precedence associate left.
+         *
+         * @tparam LargestType Type of values of the expression.
+         */
+        template<easyMath::UnsignedIntegral LargestType>
+        class ExpressionCompiler_
+        {
+            std::string_view text_;
+            std::size_t cursor_;
+            std::size_t depth_;
+            Expression<LargestType> expression_;
+
+            inline void skipWhiteSpace_() noexcept
+            {
+                cursor_ = easyParse::advanceOverWhiteSpace(text_, cursor_);
+                if(cursor_ == text_.npos)
+                    cursor_ = text_.size();
+            }
+
+            inline bool atEnd_() noexcept
+            {
+                skipWhiteSpace_();
+                return cursor_ >= text_.size();
+            }
+
+            inline void push_(ExpressionOp op, LargestType value)
+            {
+                expression_.postfix.push_back({op, value});
+
+                if(++depth_ > literal::MAX_EXPRESSION_DEPTH)
+                    throw std::invalid_argument("Expression too deeply nested");
+            }
+
+            inline void emitOperator_(ExpressionOp op)
+            {
+                auto& postfix = expression_.postfix;
+                bool isUnary = (op == ExpressionOp::NEGATE) || (op == ExpressionOp::COMPLEMENT);
+
+                if(isUnary)
+                {
+                    if(postfix.back().op == ExpressionOp::LITERAL)
+                        postfix.back().value = Expression<LargestType>::apply(op, postfix.back().value);
+                    else
+                        postfix.push_back({op, 0});
+                    return;
+                }
+
+                --depth_;
+
+                auto size = postfix.size();
+                if((postfix[size - 1].op == ExpressionOp::LITERAL) && (postfix[size - 2].op == ExpressionOp::LITERAL))
+                {
+                    postfix[size - 2].value = Expression<LargestType>::apply(op, postfix[size - 2].value, postfix[size - 1].value);
+                    postfix.pop_back();
+                }
+                else
+                    postfix.push_back({op, 0});
+            }
+
+            [[nodiscard]] static constexpr std::size_t precedence_(ExpressionOp op) noexcept
+            {
+                switch (op)
+                {
+                case ExpressionOp::MULTIPLY: [[fallthrough]];
+                case ExpressionOp::DIVIDE: [[fallthrough]];
+                case ExpressionOp::MODULO:      return 5;
+                case ExpressionOp::ADD: [[fallthrough]];
+                case ExpressionOp::SUBTRACT:    return 4;
+                case ExpressionOp::SHIFT_LEFT: [[fallthrough]];
+                case ExpressionOp::SHIFT_RIGHT: return 3;
+                case ExpressionOp::AND:         return 2;
+                case ExpressionOp::XOR:         return 1;
+                default:                        return 0;
+                }
+            }
+
+            /// @brief Peek binary operator at cursor, returns operator and its length (0 if none).
+            inline std::pair<ExpressionOp, std::size_t> peekBinary_() noexcept
+            {
+                if(atEnd_())
+                    return {ExpressionOp::LITERAL, 0};
+
+                switch (text_[cursor_])
+                {
+                case '+': return {ExpressionOp::ADD, 1};
+                case '-': return {ExpressionOp::SUBTRACT, 1};
+                case '*': return {ExpressionOp::MULTIPLY, 1};
+                case '/': return {ExpressionOp::DIVIDE, 1};
+                case '%': return {ExpressionOp::MODULO, 1};
+                case '&': return {ExpressionOp::AND, 1};
+                case '^': return {ExpressionOp::XOR, 1};
+                case '|': return {ExpressionOp::OR, 1};
+                case '<':
+                    if(easyParse::isExactSubstr(text_, "<<", cursor_))
+                        return {ExpressionOp::SHIFT_LEFT, 2};
+                    break;
+                case '>':
+                    if(easyParse::isExactSubstr(text_, ">>", cursor_))
+                        return {ExpressionOp::SHIFT_RIGHT, 2};
+                    break;
+                }
+
+                return {ExpressionOp::LITERAL, 0};
+            }
+
+            [[nodiscard]] static constexpr bool isSymbolCharacter_(char ch) noexcept
+            {
+                return easyMath::valueBetweenInclusive(ch, 'a', 'z')
+                    || easyMath::valueBetweenInclusive(ch, 'A', 'Z')
+                    || easyMath::valueBetweenInclusive(ch, '0', '9')
+                    || (ch == '_')
+                    || (ch == '@');
+            }
+
+            inline std::size_t parseIndex_()
+            {
+                auto end = text_.find(']', cursor_);
+
+                if(end == text_.npos)
+                    throw std::invalid_argument("Expected \']\' in expression");
+
+                auto index = easyParse::stripWhiteSpace(text_.substr(cursor_ + 1, end - cursor_ - 1));
+
+                if(index.empty())
+                    throw std::invalid_argument("Symbol index empty");
+
+                cursor_ = end + 1;
+                return parseWholeNumber_<std::size_t>(index, "symbol index");
+            }
+
+            inline void parsePrimary_()
+            {
+                if(atEnd_())
+                    throw std::invalid_argument("Expected operand in expression");
+
+                char ch = text_[cursor_];
+
+                if(ch == '(')
+                {
+                    ++cursor_;
+                    parseBinary_(0);
+
+                    if(atEnd_() || (text_[cursor_] != ')'))
+                        throw std::invalid_argument("Expected \')\' in expression");
+
+                    ++cursor_;
+                }
+                else if(ch == '\'')
+                {
+                    // Step quoted text state machine from opening quote, so escape pairs like '\\' are skipped whole.
+                    auto end = cursor_ + 1;
+                    auto state = easyParse::QuoteState::SINGLE;
+                    for(; end < text_.size(); ++end)
+                    {
+                        auto transition = easyParse::quoteTransition(state, text_[end]);
+                        if(transition.event == easyParse::QuoteEvent::QUOTE_CLOSE)
+                            break;
+                        state = transition.next;
+                    }
+
+                    if((end >= text_.size()) || (end == cursor_ + 1))
+                        throw std::invalid_argument("Invalid character literal in expression");
+
+                    auto text = text_.substr(cursor_ + 1, end - cursor_ - 1);
+                    push_(
+                        ExpressionOp::LITERAL,
+                        static_cast<unsigned char>((text.size() == 1) ? text[0] : easyParse::convertEscapedString(text))
+                    );
+                    cursor_ = end + 1;
+                }
+                else if(easyParse::isDecDigit(ch))
+                {
+                    auto end = cursor_;
+                    while((end < text_.size()) && isSymbolCharacter_(text_[end]))
+                        ++end;
+
+                    auto operand = text_.substr(cursor_, end - cursor_);
+                    cursor_ = end;
+
+                    if(isLocalLabelOperand(operand))
+                    {
+                        push_(ExpressionOp::LOCAL_LABEL, expression_.localLabels.size());
+                        expression_.localLabels.push_back({
+                            convertLocalLabelNumber(operand.substr(0, operand.size() - 1)), 
+                            operand.back() == literal::LOCAL_FORWARD_SUFFIX, 
+                            0
+                        });
+                    }
+                    else
+                        push_(ExpressionOp::LITERAL, parseWholeNumber_<LargestType>(operand, "number in expression"));
+                }
+                else if(isSymbolCharacter_(ch))
+                {
+                    auto end = cursor_;
+                    while((end < text_.size()) && isSymbolCharacter_(text_[end]))
+                        ++end;
+
+                    std::tuple<std::string, std::size_t, std::size_t> symbol = {
+                        static_cast<std::string>(text_.substr(cursor_, end - cursor_)), 0, 0
+                    };
+                    cursor_ = end;
+
+                    if(!atEnd_() && (text_[cursor_] == '['))
+                    {
+                        std::get<1>(symbol) = parseIndex_();
+
+                        if(!atEnd_() && (text_[cursor_] == '['))
+                            std::get<2>(symbol) = parseIndex_();
+                    }
+
+                    push_(ExpressionOp::SYMBOL, expression_.symbols.size());
+                    expression_.symbols.push_back(std::move(symbol));
+                }
+                else
+                    throw std::invalid_argument("Unexpected character in expression");
+            }
+
+            inline void parseUnary_()
+            {
+                if(atEnd_())
+                    throw std::invalid_argument("Expected operand in expression");
+
+                switch (text_[cursor_])
+                {
+                case '-':
+                    ++cursor_;
+                    parseUnary_();
+                    emitOperator_(ExpressionOp::NEGATE);
+                    break;
+                case '~':
+                    ++cursor_;
+                    parseUnary_();
+                    emitOperator_(ExpressionOp::COMPLEMENT);
+                    break;
+                case '+':
+                    ++cursor_;
+                    parseUnary_();
+                    break;
+                default:
+                    parsePrimary_();
+                    break;
+                }
+            }
+
+            inline void parseBinary_(std::size_t minPrecedence)
+            {
+                parseUnary_();
+
+                while(true)
+                {
+                    auto [op, length] = peekBinary_();
+
+                    if((length == 0) || (precedence_(op) < minPrecedence))
+                        return;
+
+                    cursor_ += length;
+                    parseBinary_(precedence_(op) + 1);
+                    emitOperator_(op);
+                }
+            }
+
+        public:
+
+            inline ExpressionCompiler_(std::string_view text)
+                : text_(text), cursor_(0), depth_(0), expression_() {}
+
+            inline Expression<LargestType> compile()
+            {
+                parseBinary_(0);
+
+                if(!atEnd_())
+                    throw std::invalid_argument("Unexpected character in expression");
+
+                return std::move(expression_);
+            }
+        };
+    }
+
+    /**
+     * @brief Compile infix expression text to postfix expression.
+     *
+     * Operands may be numbers (any `easyParse::parseNumber` format),
+     * `'c'` characters, symbol references (`symbol`, `symbol[i]`, `symbol[i][j]`) 
+     * or local label references (`1f`, `1b`), whose definition index is left 0.
+     * Literal only sub-expressions are folded.
+     *
+     * @throw `std::invalid_argument` : Malformed expression.
+     * @throw `std::out_of_range` : Number does not fit `LargestType`.
+     * @throw `std::domain_error` : Folded division or modulo by zero.
+     *
+     * @tparam LargestType Type of values of the expression.
+     * @param[in] text expression text.
+     * @return Expression<LargestType> compiled expression.
+     */
+    template<easyMath::UnsignedIntegral LargestType>
+    [[nodiscard]] inline Expression<LargestType> compileExpression(std::string_view text)
+    {
+        return impl_detail_::ExpressionCompiler_<LargestType>(text).compile();
+    }
+
+    /**
+     * @brief Check if operand text should be compiled as expression.
+     *
+     * @param[in] arg operand text, without `$` prefix.
+     * @return true operand contains expression operators.
+     */
+    [[nodiscard]] constexpr inline bool isExpressionOperand(std::string_view arg) noexcept
+    {
+        return arg.find_first_of(literal::EXPRESSION_OPERATORS) != arg.npos;
+    }
+}
+
+
+#endif // INCLUDE_GENASMLIB_EXPRESSION_H_INCLUDED
@@ -119,7 +119,7 @@ namespace gen_asm
             fileName_ = fileName;
             if(reader_.is_open())
                 reader_.close();
-            reader_.open(fileName);
+            reader_.open(fileName_);
             if(!reader_)
                 throw std::invalid_argument("unknown error");
             bufferFill();
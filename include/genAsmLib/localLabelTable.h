@@ -0,0 +1,199 @@
+/**
+ * @file localLabelTable.h 
+ * @author Harith Manoj (harithpub@gmail.com)
+ * @brief Numeric local label resolution.
+ * @date 17 October 2026
+ * 
+ * @copyright Copyright (C) 2024
+ * 
+ * 
+ *                      APACHE LICENSE 2.0
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * 
+ */
+
+
+#ifndef INCLUDE_GENASMLIB_LOCALLABELTABLE_H_INCLUDED
+
+/// @brief include\genAsmLib\localLabelTable.h Header Guard 
+#define INCLUDE_GENASMLIB_LOCALLABELTABLE_H_INCLUDED
+
+#include <optional>
+#include <unordered_map>
+
+#include "tokeniser.h"
+
+namespace gen_asm
+{
+    /**
+     * @brief Resolve GNU style numeric local labels (`1:` referred by `1f` / `1b`) in a single pass.
+     * 
+     * Each label number used keeps its latest definition and a stack of forward fixups 
+     * waiting for its next definition, in a map keyed by number, so memory follows 
+     * labels used rather than largest label number.
+     * 
+     * @tparam AddressType type of address of labels.
+     * @tparam Fixup caller defined record of location to patch once forward reference is resolved.
+     */
+    template<easyMath::Integral AddressType, class Fixup>
+    class LocalLabelTable
+    {
+        struct Slot_
+        {
+            AddressType lastDefinition;
+            bool isDefined;
+            std::vector<Fixup> pendingFixups;
+        };
+
+        std::unordered_map<std::size_t, Slot_> slots_;
+        std::size_t pendingCount_;
+
+        inline Slot_& slot_(std::size_t number)
+        {
+            return slots_.try_emplace(number, Slot_{0, false, {}}).first->second;
+        }
+
+    public:
+
+        inline LocalLabelTable() : slots_(), pendingCount_(0) {}
+
+        /**
+         * @brief Define local label at address, patch all pending forward references to it.
+         * 
+         * @tparam Patcher callable taking `(const Fixup&, AddressType)`.
+         * @param[in] number label number.
+         * @param[in] address address of definition.
+         * @param[in] patch callable to patch each pending fixup.
+         */
+        template<class Patcher>
+        inline void define(std::size_t number, AddressType address, Patcher&& patch)
+        {
+            auto& slot = slot_(number);
+
+            for(const auto& fixup : slot.pendingFixups)
+                patch(fixup, address);
+
+            pendingCount_ -= slot.pendingFixups.size();
+            slot.pendingFixups.clear();
+            slot.lastDefinition = address;
+            slot.isDefined = true;
+        }
+
+        /**
+         * @brief Resolve reference to local label.
+         * 
+         * @throw `std::invalid_argument` : Backward reference to label not defined yet.
+         * 
+         * @param[in] reference label reference.
+         * @param[in] fixup location to patch, recorded if reference is forward.
+         * @return std::optional<AddressType> address for backward references, empty for forward references.
+         */
+        inline std::optional<AddressType> reference(const LocalLabelReference& reference, const Fixup& fixup)
+        {
+            auto& slot = slot_(reference.number);
+
+            if(!reference.isForward)
+            {
+                if(!slot.isDefined)
+                    throw std::invalid_argument("Backward reference to undefined local label");
+
+                return slot.lastDefinition;
+            }
+
+            slot.pendingFixups.push_back(fixup);
+            ++pendingCount_;
+            return std::nullopt;
+        }
+
+        /// @brief Number of forward references not resolved yet.
+        inline std::size_t pendingCount() const noexcept { return pendingCount_; }
+
+        /**
+         * @brief Close translation unit, clears all labels.
+         * 
+         * @throw `std::invalid_argument` : Forward references without following definition.
+         */
+        inline void finalize()
+        {
+            if(pendingCount_ != 0)
+                throw std::invalid_argument("Forward reference to local label without following definition");
+
+            slots_.clear();
+        }
+
+        /// @brief Drop all labels and pending fixups, for a unit abandoned after an error.
+        inline void clear() noexcept
+        {
+            slots_.clear();
+            pendingCount_ = 0;
+        }
+    };
+
+    /**
+     * @brief All definitions of numeric local labels of a translation unit, for two pass assembly.
+     * 
+     * Definitions are kept per label number in source order, and found by the definition 
+     * index `Tokenizer` sets in each `LocalLabelReference`.
+     * 
+     * @tparam Definition caller defined record of definition.
+     */
+    template<class Definition>
+    class LocalLabelDefinitions
+    {
+        std::unordered_map<std::size_t, std::vector<Definition>> definitions_;
+
+    public:
+
+        /// @brief Add next definition of label number.
+        inline void define(std::size_t number, const Definition& definition)
+        {
+            definitions_[number].push_back(definition);
+        }
+
+        /// @brief Number of definitions of label number.
+        inline std::size_t count(std::size_t number) const noexcept
+        {
+            auto iter = definitions_.find(number);
+            return (iter == definitions_.end()) ? 0 : iter->second.size();
+        }
+
+        /**
+         * @brief Definition referred by reference.
+         * 
+         * @throw `std::invalid_argument` : No such definition (forward reference without following definition).
+         */
+        inline const Definition& find(const LocalLabelReference& reference) const
+        {
+            auto iter = definitions_.find(reference.number);
+
+            if((iter == definitions_.end()) || (reference.definition >= iter->second.size()))
+                throw std::invalid_argument("Reference to undefined local label");
+
+            return iter->second[reference.definition];
+        }
+
+        /// @brief Call function with every definition, which it may modify.
+        template<std::invocable<Definition&> Function>
+        inline void forEach(Function&& function)
+        {
+            for(auto& [number, definitions] : definitions_)
+                for(auto& definition : definitions)
+                    function(definition);
+        }
+    };
+}
+
+
+#endif // INCLUDE_GENASMLIB_LOCALLABELTABLE_H_INCLUDED
+
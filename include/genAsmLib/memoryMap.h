@@ -0,0 +1,201 @@
+/**
+ * @file memoryMap.h 
+ * @author Harith Manoj (harithpub@gmail.com)
+ * @brief Placed regions of an address space, with overlap checking.
+ * @date 17 October 2026
+ * 
+ * @copyright Copyright (C) 2024
+ * 
+ * 
+ *                      APACHE LICENSE 2.0
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * 
+ */
+
+
+#ifndef INCLUDE_GENASMLIB_MEMORYMAP_H_INCLUDED
+
+/// @brief include\genAsmLib\memoryMap.h Header Guard 
+#define INCLUDE_GENASMLIB_MEMORYMAP_H_INCLUDED
+
+#include <map>
+#include <string>
+#include <vector>
+#include <optional>
+#include <stdexcept>
+#include <iterator>
+#include <string_view>
+
+namespace gen_asm
+{
+    /// @brief Region `[start, end)` of address space.
+    struct MemoryRegion
+    {
+        std::size_t start;
+        std::size_t end;
+        std::string name;
+    };
+
+    /**
+     * @brief Disjoint regions placed in an address space of given size.
+     * 
+     * Regions are indexed by start in an ordered map. As placed regions never overlap, 
+     * a region can only overlap its predecessor or successor, so placing and overlap 
+     * queries are O(log n) however many regions are placed.
+     */
+    class MemoryMap
+    {
+        std::size_t spaceSize_;
+        std::map<std::size_t, MemoryRegion> regions_;
+
+    public:
+
+        /// @param[in] spaceSize number of addressable units, usually `max(AddressType) + 1`.
+        inline MemoryMap(std::size_t spaceSize) : spaceSize_(spaceSize), regions_() {}
+
+        inline std::size_t spaceSize() const noexcept { return spaceSize_; }
+        inline std::size_t size() const noexcept { return regions_.size(); }
+
+        inline auto begin() const { return regions_.begin(); }
+        inline auto end() const { return regions_.end(); }
+
+        /// @brief Placed region overlapping `[start, start + size)`, if any.
+        inline std::optional<MemoryRegion> findOverlap(std::size_t start, std::size_t size) const
+        {
+            if(size == 0)
+                return std::nullopt;
+
+            auto next = regions_.lower_bound(start);
+
+            if((next != regions_.end()) && (next->first < start + size))
+                return next->second;
+
+            if(next != regions_.begin())
+            {
+                auto previous = std::prev(next);
+                if(previous->second.end > start)
+                    return previous->second;
+            }
+
+            return std::nullopt;
+        }
+
+        /**
+         * @brief Place region, empty regions are ignored.
+         * 
+         * @throw `std::out_of_range` : Region wraps past end of address space.
+         * @throw `std::domain_error` : Region overlaps placed region.
+         */
+        inline void place(std::size_t start, std::size_t size, std::string_view name)
+        {
+            if(size == 0)
+                return;
+
+            if((start >= spaceSize_) || (size > spaceSize_ - start))
+                throw std::out_of_range("Region " + std::string(name) + " wraps past end of address space");
+
+            if(auto overlap = findOverlap(start, size))
+                throw std::domain_error("Region " + std::string(name) + " overlaps region " + overlap->name);
+
+            regions_.emplace(start, MemoryRegion{start, start + size, std::string(name)});
+        }
+
+        /// @brief Gaps between placed regions, in address order.
+        inline std::vector<MemoryRegion> freeSpace() const
+        {
+            std::vector<MemoryRegion> free;
+            std::size_t cursor = 0;
+
+            for(const auto& [start, region] : regions_)
+            {
+                if(start > cursor)
+                    free.push_back({cursor, start, {}});
+                cursor = region.end;
+            }
+
+            if(cursor < spaceSize_)
+                free.push_back({cursor, spaceSize_, {}});
+
+            return free;
+        }
+
+        /// @brief Placed regions and free space as JSON object, names escaped as JSON strings.
+        inline std::string toJson() const
+        {
+            auto appendName = [](std::string& out, std::string_view name)
+            {
+                constexpr std::string_view HEX_DIGITS = "0123456789abcdef";
+
+                out += '"';
+                for(char ch : name)
+                {
+                    auto code = static_cast<unsigned char>(ch);
+
+                    if((ch == '"') || (ch == '\\'))
+                    {
+                        out += '\\';
+                        out += ch;
+                    }
+                    else if(code < 0x20)
+                    {
+                        out += "\\u00";
+                        out += HEX_DIGITS[code >> 4];
+                        out += HEX_DIGITS[code & 0xF];
+                    }
+                    else
+                        out += ch;
+                }
+                out += '"';
+            };
+
+            auto appendRegion = [&](std::string& out, const MemoryRegion& region, bool withName)
+            {
+                out += "{\"start\": " + std::to_string(region.start) + ", \"end\": " + std::to_string(region.end);
+                if(withName)
+                {
+                    out += ", \"name\": ";
+                    appendName(out, region.name);
+                }
+                out += "}";
+            };
+
+            std::string out = "{\"spaceSize\": " + std::to_string(spaceSize_) + ", \"regions\": [";
+
+            bool first = true;
+            for(const auto& [start, region] : regions_)
+            {
+                out += first ? "" : ", ";
+                appendRegion(out, region, true);
+                first = false;
+            }
+
+            out += "], \"free\": [";
+
+            first = true;
+            for(const auto& region : freeSpace())
+            {
+                out += first ? "" : ", ";
+                appendRegion(out, region, false);
+                first = false;
+            }
+
+            out += "]}";
+            return out;
+        }
+    };
+}
+
+
+#endif // INCLUDE_GENASMLIB_MEMORYMAP_H_INCLUDED
+
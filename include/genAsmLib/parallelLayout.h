@@ -0,0 +1,235 @@
+/**
+ * @file parallelLayout.h 
+ * @author Harith Manoj (harithpub@gmail.com)
+ * @brief Parallel prefix sum address assignment.
+ * @date 17 October 2026
+ * 
+ * @copyright Copyright (C) 2024
+ * 
+ * 
+ *                      APACHE LICENSE 2.0
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * 
+ */
+
+
+#ifndef INCLUDE_GENASMLIB_PARALLELLAYOUT_H_INCLUDED
+
+/// @brief include\genAsmLib\parallelLayout.h Header Guard 
+#define INCLUDE_GENASMLIB_PARALLELLAYOUT_H_INCLUDED
+
+#include <span>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <exception>
+#include <mutex>
+
+#include "addressResolver.h"
+
+namespace gen_asm
+{
+    namespace impl_detail_
+    {
+        /**
+         * @brief Call `fn(i)` for every `i` in `[0, count)` on up to `threadCount` threads.
+         * 
+         * First exception thrown by any call is rethrown after all threads join. 
+         * If a thread fails to start, remaining calls are abandoned and the failure is 
+         * rethrown once started threads join.
+         */
+        template<class Fn>
+        inline void parallelFor_(std::size_t count, std::size_t threadCount, Fn&& fn)
+        {
+            threadCount = std::clamp<std::size_t>(threadCount, 1, std::max<std::size_t>(count, 1));
+
+            if(threadCount == 1)
+            {
+                for(std::size_t i = 0; i < count; ++i)
+                    fn(i);
+                return;
+            }
+
+            std::atomic<std::size_t> next = 0;
+            std::exception_ptr error = nullptr;
+            std::mutex errorLock;
+
+            auto worker = [&]()
+            {
+                try
+                {
+                    for(auto i = next.fetch_add(1, std::memory_order_relaxed); i < count; i = next.fetch_add(1, std::memory_order_relaxed))
+                        fn(i);
+                }
+                catch(...)
+                {
+                    std::scoped_lock guard(errorLock);
+                    if(!error)
+                        error = std::current_exception();
+                    next.store(count, std::memory_order_relaxed);
+                }
+            };
+
+            // Declared after state workers use, so threads join on unwinding before it is destroyed.
+            std::vector<std::jthread> threads;
+
+            try
+            {
+                threads.reserve(threadCount - 1);
+
+                for(std::size_t i = 1; i < threadCount; ++i)
+                    threads.emplace_back(worker);
+            }
+            catch(...)
+            {
+                next.store(count, std::memory_order_relaxed);
+                throw;
+            }
+
+            worker();
+
+            for(auto& thread : threads)
+                thread.join();
+
+            if(error)
+                std::rethrow_exception(error);
+        }
+
+        inline std::size_t defaultThreadCount_() noexcept
+        {
+            return std::max<unsigned>(std::thread::hardware_concurrency(), 1);
+        }
+    }
+
+    /// @brief Addresses of items of chunks laid out one after another.
+    struct ChunkLayout
+    {
+        /// @brief Address of first item of each chunk.
+        std::vector<std::size_t> chunkBases;
+
+        /// @brief Address of each item, per chunk.
+        std::vector<std::vector<std::size_t>> itemAddresses;
+
+        /// @brief Address after last item of last chunk.
+        std::size_t end;
+    };
+
+    /**
+     * @brief Lay chunks of items out one after another, as a parallel prefix sum of item widths.
+     * 
+     * Each chunk scans widths of its items and reduces to its size in parallel, 
+     * chunk bases are exclusive scan of chunk sizes, then each chunk adds its base to 
+     * its items in parallel. Result equals sequential layout of all items in order.
+     * 
+     * @tparam Item type of item.
+     * @tparam WidthOf callable `std::size_t (const Item&)`.
+     * @param[in] chunks items of each chunk, in order.
+     * @param[in] widthOf width of item in basic units.
+     * @param[in] base address of first item.
+     * @param[in] threadCount maximum number of threads.
+     */
+    template<class Item, class WidthOf>
+    inline ChunkLayout layoutChunks(
+        std::span<const std::span<const Item>> chunks, 
+        WidthOf&& widthOf, 
+        std::size_t base = 0,
+        std::size_t threadCount = impl_detail_::defaultThreadCount_()
+    )
+    {
+        ChunkLayout layout = {};
+        layout.chunkBases.resize(chunks.size());
+        layout.itemAddresses.resize(chunks.size());
+
+        impl_detail_::parallelFor_(chunks.size(), threadCount, [&](std::size_t c)
+        {
+            auto& addresses = layout.itemAddresses[c];
+            addresses.resize(chunks[c].size());
+
+            std::size_t offset = 0;
+            for(std::size_t i = 0; i < chunks[c].size(); ++i)
+            {
+                addresses[i] = offset;
+                offset += widthOf(chunks[c][i]);
+            }
+
+            layout.chunkBases[c] = offset;
+        });
+
+        layout.end = base;
+        for(auto& chunkBase : layout.chunkBases)
+        {
+            auto size = chunkBase;
+            chunkBase = layout.end;
+            layout.end += size;
+        }
+
+        impl_detail_::parallelFor_(chunks.size(), threadCount, [&](std::size_t c)
+        {
+            for(auto& address : layout.itemAddresses[c])
+                address += layout.chunkBases[c];
+        });
+
+        return layout;
+    }
+
+    /**
+     * @brief Lay chunks of instructions of one code section out in parallel.
+     * 
+     * @see layoutChunks
+     */
+    template<IsaTraitModel IsaTraits, AddressResolverTraitModel<IsaTraits> AddrTraits>
+    inline ChunkLayout layoutInstructions(
+        const AddrTraits& traits,
+        std::span<const std::span<const InstructionToken<IsaTraits>>> chunks, 
+        std::size_t base = 0,
+        std::size_t threadCount = impl_detail_::defaultThreadCount_()
+    )
+    {
+        return layoutChunks(
+            chunks, 
+            [&](const InstructionToken<IsaTraits>& instr) { return traits.getInstrWidthInBasic(instr.opCode); }, 
+            base, threadCount
+        );
+    }
+
+    /**
+     * @brief Lay chunks of symbols of one data section out in parallel, non-data symbols take no space.
+     * 
+     * @see layoutChunks
+     */
+    template<IsaTraitModel IsaTraits, AddressResolverTraitModel<IsaTraits> AddrTraits>
+    inline ChunkLayout layoutDataSymbols(
+        const AddrTraits& traits,
+        std::span<const std::span<const SymbolToken<IsaTraits>>> chunks, 
+        std::size_t base = 0,
+        std::size_t threadCount = impl_detail_::defaultThreadCount_()
+    )
+    {
+        return layoutChunks(
+            chunks, 
+            [&](const SymbolToken<IsaTraits>& symbol) -> std::size_t
+            { 
+                if(symbol.symbolType != SymbolType::DATA)
+                    return 0;
+                return traits.getSizeInBasic(symbol.blockSizeCode) * symbol.elementCount; 
+            }, 
+            base, threadCount
+        );
+    }
+}
+
+
+#endif // INCLUDE_GENASMLIB_PARALLELLAYOUT_H_INCLUDED
+
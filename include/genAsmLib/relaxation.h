@@ -0,0 +1,388 @@
+/**
+ * @file relaxation.h 
+ * @author Harith Manoj (harithpub@gmail.com)
+ * @brief Iterative relaxation of variable width instructions.
+ * @date 17 October 2026
+ * 
+ * @copyright Copyright (C) 2024
+ * 
+ * 
+ *                      APACHE LICENSE 2.0
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * 
+ */
+
+
+#ifndef INCLUDE_GENASMLIB_RELAXATION_H_INCLUDED
+
+/// @brief include\genAsmLib\relaxation.h Header Guard 
+#define INCLUDE_GENASMLIB_RELAXATION_H_INCLUDED
+
+#include <vector>
+#include <span>
+#include <algorithm>
+#include <unordered_map>
+
+#include "tokeniser.h"
+#include "addressResolver.h"
+#include "symbolTable.h"
+
+namespace gen_asm
+{
+    /**
+     * @brief Check if type can choose width of instructions from their target.
+     * 
+     * Must Have:
+     * 
+     * @conceptMember{Methods}
+     * - `std::size_t getMinInstrWidth(IsaTraits::OpCodeType) noexcept`
+     *      - Width of shortest encoding of op code.
+     * - `std::size_t getRelaxedWidth(IsaTraits::OpCodeType, IsaTraits::LargestType target, IsaTraits::AddressType address) noexcept`
+     *      - Width of shortest encoding able to reach target (address or value) from instruction at address.
+     *      - Must depend on address only for pc relative op codes.
+     * - `[bool] isPcRelative(IsaTraits::OpCodeType) noexcept`
+     *      - Whether op code reaches its target relative to its own address.
+     */
+    template<class Traits, class IsaTraits>
+    concept RelaxationTraitModel = requires(
+        const Traits& trait,
+        const typename IsaTraits::OpCodeType& op,
+        const typename IsaTraits::LargestType& target,
+        const typename IsaTraits::AddressType& address
+    )
+    {
+        requires IsaTraitModel<IsaTraits>;
+
+        { trait.getMinInstrWidth(op) } -> std::same_as<std::size_t>;
+        noexcept(trait.getMinInstrWidth(op));
+
+        { trait.getRelaxedWidth(op, target, address) } -> std::same_as<std::size_t>;
+        noexcept(trait.getRelaxedWidth(op, target, address));
+
+        { trait.isPcRelative(op) } -> std::convertible_to<bool>;
+        noexcept(trait.isPcRelative(op));
+    };
+
+    namespace literal
+    {
+        /// @brief Relaxation item with no label target.
+        constexpr std::size_t NO_RELAXATION_TARGET = static_cast<std::size_t>(-1);
+    }
+
+    /// @brief Instruction to be relaxed, target is label (laid out with code) or fixed value.
+    template<IsaTraitModel IsaTraits>
+    struct RelaxationItem
+    {
+        typename IsaTraits::OpCodeType opCode;
+
+        /// @brief Label referred by instruction, `literal::NO_RELAXATION_TARGET` if none.
+        std::size_t targetLabel;
+
+        /// @brief Target value if instruction has no label target (data address, constant).
+        typename IsaTraits::LargestType value;
+    };
+
+    /// @brief Widths and addresses of relaxed instructions and labels.
+    struct RelaxationResult
+    {
+        std::vector<std::size_t> widths;
+        std::vector<std::size_t> addresses;
+        std::vector<std::size_t> labelAddresses;
+
+        /// @brief Number of width evaluations done to reach fixed point.
+        std::size_t evaluations;
+    };
+
+    namespace impl_detail_
+    {
+        /// @brief Prefix sums under point updates, both in O(log n).
+        class FenwickTree_
+        {
+            std::vector<std::size_t> tree_;
+
+        public:
+            inline FenwickTree_(std::size_t size) : tree_(size + 1, 0) {}
+
+            inline void add(std::size_t i, std::size_t delta) noexcept
+            {
+                for(++i; i < tree_.size(); i += i & (~i + 1))
+                    tree_[i] += delta;
+            }
+
+            /// @brief Sum of `[0, i)`.
+            inline std::size_t prefix(std::size_t i) const noexcept
+            {
+                std::size_t sum = 0;
+                for(; i > 0; i -= i & (~i + 1))
+                    sum += tree_[i];
+                return sum;
+            }
+        };
+    }
+
+    /**
+     * @brief Choose shortest encoding of every instruction whose target fits, iterating to a fixed point.
+     * 
+     * Instructions start at their shortest width and only grow, so relaxation terminates. 
+     * Addresses are prefix sums kept in a Fenwick tree. After each round only instructions 
+     * whose displacement (pc relative) or target (absolute) spans a grown instruction are 
+     * re-evaluated, instead of laying out whole section again.
+     * 
+     * Sections are tokenized at `getInstrWidthInBasic`, the standard expansion, `relaxCodeSection` 
+     * applies result to a section of `AddressResolver` and jump symbols of `SymbolTable`.
+     * 
+     * @param[in] traits relaxation traits.
+     * @param[in] items instructions of one code section, in order.
+     * @param[in] labels index of instruction each label is defined before (`items.size()` for end).
+     * @param[in] base address of first instruction.
+     * 
+     * @throw `std::out_of_range` : Label defined after end, or item refers to unknown label.
+     */
+    template<IsaTraitModel IsaTraits, RelaxationTraitModel<IsaTraits> Traits>
+    inline RelaxationResult relaxInstructions(
+        const Traits& traits,
+        std::span<const RelaxationItem<IsaTraits>> items,
+        std::span<const std::size_t> labels,
+        std::size_t base = 0
+    )
+    {
+        for(auto label : labels)
+            if(label > items.size())
+                throw std::out_of_range("Label defined beyond end of section");
+
+        RelaxationResult result = {};
+        result.widths.resize(items.size());
+
+        impl_detail_::FenwickTree_ layout(items.size());
+
+        std::vector<std::size_t> worklist(items.size());
+        std::vector<std::size_t> labelled;
+
+        for(std::size_t i = 0; i < items.size(); ++i)
+        {
+            result.widths[i] = traits.getMinInstrWidth(items[i].opCode);
+            layout.add(i, result.widths[i]);
+            worklist[i] = i;
+
+            if(items[i].targetLabel == literal::NO_RELAXATION_TARGET)
+                continue;
+
+            if(items[i].targetLabel >= labels.size())
+                throw std::out_of_range("Relaxation item refers to unknown label");
+
+            labelled.push_back(i);
+        }
+
+        std::vector<std::size_t> grown;
+
+        while(!worklist.empty())
+        {
+            grown.clear();
+
+            for(auto i : worklist)
+            {
+                ++result.evaluations;
+
+                const auto& item = items[i];
+                auto address = base + layout.prefix(i);
+                auto target = (item.targetLabel == literal::NO_RELAXATION_TARGET) ? 
+                    item.value 
+                    : static_cast<typename IsaTraits::LargestType>(base + layout.prefix(labels[item.targetLabel]));
+
+                auto width = traits.getRelaxedWidth(
+                    item.opCode, target, static_cast<typename IsaTraits::AddressType>(address)
+                );
+
+                if(width <= result.widths[i])
+                    continue;
+
+                layout.add(i, width - result.widths[i]);
+                result.widths[i] = width;
+                grown.push_back(i);
+            }
+
+            worklist.clear();
+
+            if(grown.empty())
+                break;
+
+            // Re-evaluate only instructions whose distance to target (pc relative) or target (absolute) moved.
+            for(auto i : labelled)
+            {
+                auto label = labels[items[i].targetLabel];
+                bool moved = false;
+
+                if(traits.isPcRelative(items[i].opCode))
+                {
+                    auto iter = std::ranges::lower_bound(grown, std::min(i, label));
+                    moved = (iter != grown.end()) && (*iter < std::max(i, label));
+                }
+                else
+                    moved = grown.front() < label;
+
+                if(moved)
+                    worklist.push_back(i);
+            }
+        }
+
+        result.addresses.resize(items.size());
+        for(std::size_t i = 0; i < items.size(); ++i)
+            result.addresses[i] = base + layout.prefix(i);
+
+        result.labelAddresses.resize(labels.size());
+        for(std::size_t l = 0; l < labels.size(); ++l)
+            result.labelAddresses[l] = base + layout.prefix(labels[l]);
+
+        return result;
+    }
+
+    /**
+     * @brief Relax code section tokenized at standard widths, and lay it out again from relaxed widths.
+     * 
+     * Target of instruction is its last operand, either a label of section (jump symbol, local label, 
+     * or instruction reached at standard widths by a literal displacement of pc relative op code), 
+     * or a value (literal, const or data symbol, expression not over code). Jump symbols and local 
+     * labels of section move to their relaxed offsets, and section takes its relaxed size, sections 
+     * after it move on next `AddressResolver::layoutSections`.
+     * 
+     * @param[in] instrs every instruction of section, in order.
+     * @return widths and addresses relative to base of section, to encode instructions at.
+     * 
+     * @throw `std::invalid_argument` : Instructions do not fill section, or target is code outside section, 
+     * an expression over code, or a displacement not reaching an instruction of section.
+     * @throw see `SymbolTable::bind`, `SymbolTable::resolveLocalLabel` and `AddressResolver::resizeSection`.
+     */
+    template<
+        IsaTraitModel IsaTraits, 
+        RelaxationTraitModel<IsaTraits> Traits,
+        SymbolTraitModel<IsaTraits> SymbolTraits,
+        AddressResolverModel<IsaTraits> AddressResolver
+    >
+        requires AddressResolverTraitModel<Traits, IsaTraits>
+    inline RelaxationResult relaxCodeSection(
+        const Traits& traits,
+        SymbolTable<IsaTraits, SymbolTraits, AddressResolver>& table,
+        AddressResolver& resolver,
+        typename SymbolTraits::TranslationId id,
+        std::size_t section,
+        std::span<const InstructionToken<IsaTraits>> instrs
+    )
+    {
+        // Offsets at standard widths, last is end of section.
+        std::vector<std::size_t> offsets(instrs.size() + 1, 0);
+        for(std::size_t i = 0; i < instrs.size(); ++i)
+            offsets[i + 1] = offsets[i] + traits.getInstrWidthInBasic(instrs[i].opCode);
+
+        if(offsets.back() != resolver.getSection(section).offset)
+            throw std::invalid_argument("Instructions do not fill section");
+
+        std::vector<std::size_t> labels;
+        std::unordered_map<std::size_t, std::size_t> labelOfOffset;
+
+        auto labelAt = [&](std::size_t offset)
+        {
+            auto iter = std::ranges::lower_bound(offsets, offset);
+
+            if((iter == offsets.end()) || (*iter != offset))
+                throw std::invalid_argument("Target is not an instruction of section");
+
+            auto [label, isNew] = labelOfOffset.try_emplace(offset, labels.size());
+            if(isNew)
+                labels.push_back(static_cast<std::size_t>(iter - offsets.begin()));
+
+            return label->second;
+        };
+
+        auto labelOf = [&](const std::pair<std::size_t, std::size_t>& location)
+        {
+            if(location.first != section)
+                throw std::invalid_argument("Target is code outside section");
+
+            return labelAt(location.second);
+        };
+
+        std::vector<RelaxationItem<IsaTraits>> items(instrs.size());
+
+        for(std::size_t i = 0; i < instrs.size(); ++i)
+        {
+            const auto& instr = instrs[i];
+            auto& item = items[i];
+            item = {instr.opCode, literal::NO_RELAXATION_TARGET, 0};
+
+            if(instr.operands.count == 0)
+                continue;
+
+            auto target = instr.operands.count - 1;
+
+            if(instr.operands.isResolved(target))
+            {
+                item.value = instr.operands.values[target];
+
+                if(traits.isPcRelative(instr.opCode))
+                    item.targetLabel = labelAt(offsets[i] + 1 + item.value);
+
+                continue;
+            }
+
+            for(const auto& [position, data] : instr.symbolArgs)
+            {
+                if(position != target)
+                    continue;
+
+                if(auto location = table.findCodeLabel(id, data))
+                    item.targetLabel = labelOf(*location);
+                else
+                    item.value = table.resolveSymbol(id, data);
+            }
+
+            for(const auto& [position, reference] : instr.localLabelArgs)
+                if(position == target)
+                    item.targetLabel = labelOf(table.findCodeLabel(id, reference));
+
+            for(const auto& [position, expression] : instr.expressionArgs)
+            {
+                if(position != target)
+                    continue;
+
+                bool isOverCode = !expression.localLabels.empty() || std::ranges::any_of(
+                    expression.symbols, [&](const auto& data) { return table.findCodeLabel(id, data).has_value(); }
+                );
+
+                if(isOverCode)
+                    throw std::invalid_argument("Target is an expression over code");
+
+                item.value = table.resolveExpression(id, expression);
+            }
+        }
+
+        auto result = relaxInstructions<IsaTraits>(
+            traits, std::span<const RelaxationItem<IsaTraits>>(items), std::span<const std::size_t>(labels)
+        );
+
+        auto size = instrs.empty() ? 0 : result.addresses.back() + result.widths.back();
+        resolver.resizeSection(section, size);
+
+        table.relocateCodeLabels(section, [&](std::size_t offset)
+        {
+            auto i = static_cast<std::size_t>(std::ranges::lower_bound(offsets, offset) - offsets.begin());
+            return (i < instrs.size()) ? result.addresses[i] : size;
+        });
+
+        return result;
+    }
+}
+
+
+#endif // INCLUDE_GENASMLIB_RELAXATION_H_INCLUDED
+
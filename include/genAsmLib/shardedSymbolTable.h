@@ -0,0 +1,361 @@
+/**
+ * @file shardedSymbolTable.h 
+ * @author Harith Manoj (harithpub@gmail.com)
+ * @brief Symbol table sharded per translation unit for concurrent population.
+ * @date 17 October 2026
+ * 
+ * @copyright Copyright (C) 2024
+ * 
+ * 
+ *                      APACHE LICENSE 2.0
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * 
+ */
+
+
+#ifndef INCLUDE_GENASMLIB_SHARDEDSYMBOLTABLE_H_INCLUDED
+
+/// @brief include\genAsmLib\shardedSymbolTable.h Header Guard 
+#define INCLUDE_GENASMLIB_SHARDEDSYMBOLTABLE_H_INCLUDED
+
+#include <mutex>
+#include <memory>
+#include <unordered_map>
+#include <functional>
+
+#include "symbolTable.h"
+#include "parallelLayout.h"
+
+namespace gen_asm
+{
+    /**
+     * @brief Symbol table split into one shard per translation unit.
+     * 
+     * Each translation unit owns a `SymbolTable` and `AddressResolver` of its own, 
+     * so units can be populated from different threads without locking. Exported symbols 
+     * are additionally inserted into a lock striped global map, which detects duplicate 
+     * exports as they are inserted.
+     * 
+     * Local symbols clashing with exports of other units are detected by `finalize`,
+     * after all units are populated.
+     * 
+     * Translation unit ids must be in `[0, unitCount)`.
+     * 
+     * @tparam EXPORT_STRIPES number of independently locked partitions of export map.
+     */
+    template<
+        IsaTraitModel IsaTraits, 
+        SymbolTraitModel<IsaTraits> SymbolTraits, 
+        AddressResolverModel<IsaTraits> AddressResolver,
+        std::size_t EXPORT_STRIPES = 16
+    >
+        requires std::default_initializable<AddressResolver>
+    class ShardedSymbolTable
+    {
+    public:
+        using Shard = SymbolTable<IsaTraits, SymbolTraits, AddressResolver>;
+        using TranslationId = typename SymbolTraits::TranslationId;
+
+    private:
+        struct ShardEntry_
+        {
+            AddressResolver resolver;
+            Shard table;
+
+            template<class... Args>
+            inline ShardEntry_(Args&&... args) : resolver(), table(resolver, std::forward<Args&&>(args)...) {}
+        };
+
+        struct ExportStripe_
+        {
+            std::mutex lock;
+            std::unordered_map<std::string, TranslationId, StringViewHash, std::equal_to<>> exports;
+        };
+
+        std::vector<std::unique_ptr<ShardEntry_>> shards_;
+        std::array<ExportStripe_, EXPORT_STRIPES> exportStripes_;
+
+        inline ExportStripe_& stripe_(std::string_view name) noexcept
+        {
+            return exportStripes_[std::hash<std::string_view>{}(name) % EXPORT_STRIPES];
+        }
+
+        inline const ExportStripe_& stripe_(std::string_view name) const noexcept
+        {
+            return exportStripes_[std::hash<std::string_view>{}(name) % EXPORT_STRIPES];
+        }
+
+        inline void addExport_(TranslationId id, const std::string& name)
+        {
+            auto& stripe = stripe_(name);
+            std::scoped_lock guard(stripe.lock);
+
+            if(!stripe.exports.try_emplace(name, id).second)
+                throw std::domain_error("Symbol name already exists, (either the existing symbol or new symbol is exported)");
+        }
+
+        /// @brief Release export reserved by `addExport_` of a symbol that could not be added.
+        inline void removeExport_(const std::string& name) noexcept
+        {
+            auto& stripe = stripe_(name);
+            std::scoped_lock guard(stripe.lock);
+
+            stripe.exports.erase(name);
+        }
+
+        /// @brief Owner of export, only valid once population is complete.
+        inline const TranslationId* findExport_(std::string_view name) const
+        {
+            const auto& stripe = stripe_(name);
+            auto iter = stripe.exports.find(name);
+
+            return (iter == stripe.exports.end()) ? nullptr : &iter->second;
+        }
+
+    public:
+
+        template<class... Args>
+        inline ShardedSymbolTable(std::size_t unitCount, const Args&... args)
+            : shards_(), exportStripes_()
+        {
+            shards_.reserve(unitCount);
+            for(std::size_t i = 0; i < unitCount; ++i)
+                shards_.push_back(std::make_unique<ShardEntry_>(args...));
+        }
+
+        inline std::size_t unitCount() const noexcept { return shards_.size(); }
+
+        inline Shard& shard(TranslationId id) { return shards_.at(id)->table; }
+        inline const Shard& shard(TranslationId id) const { return shards_.at(id)->table; }
+
+        inline AddressResolver& resolver(TranslationId id) { return shards_.at(id)->resolver; }
+        inline const AddressResolver& resolver(TranslationId id) const { return shards_.at(id)->resolver; }
+
+        /**
+         * @brief Add symbol to shard of unit, safe to call concurrently for different units.
+         * 
+         * Export is reserved before symbol is added to shard, and released if adding fails, 
+         * so a failed call leaves neither shard nor exports changed.
+         * 
+         * @throw `std::domain_error` : Symbol already exists in unit, or exported symbol already exported by any unit.
+         * @throw see `SymbolTable::addSymbol`.
+         */
+        inline void addSymbol(TranslationId id, const SymbolToken<IsaTraits>& symbol)
+        {
+            auto& entry = *shards_.at(id);
+
+            if(symbol.isExport)
+                addExport_(id, symbol.symbolName);
+
+            try
+            {
+                entry.table.addSymbol(id, symbol);
+            }
+            catch(...)
+            {
+                if(symbol.isExport)
+                    removeExport_(symbol.symbolName);
+                throw;
+            }
+        }
+
+        /**
+         * @brief Add all symbols of unit, safe to call concurrently for different units.
+         * 
+         * Exports are reserved before symbols are added to shard, and released if any fails, 
+         * so a failed call leaves neither shard nor exports changed.
+         * 
+         * @throw see `SymbolTable::addSymbols`, `std::domain_error` : Exported symbol already exported by any unit.
+         */
+        inline void addSymbols(TranslationId id, std::span<const BatchSymbol<IsaTraits>> symbols)
+        {
+            auto& entry = *shards_.at(id);
+            std::size_t reserved = 0;
+
+            auto release = [&]() noexcept
+            {
+                for(const auto& batchSymbol : symbols)
+                {
+                    if(reserved == 0)
+                        break;
+
+                    if(batchSymbol.symbol.isExport)
+                    {
+                        removeExport_(batchSymbol.symbol.symbolName);
+                        --reserved;
+                    }
+                }
+            };
+
+            try
+            {
+                for(const auto& batchSymbol : symbols)
+                {
+                    if(batchSymbol.symbol.isExport)
+                    {
+                        addExport_(id, batchSymbol.symbol.symbolName);
+                        ++reserved;
+                    }
+                }
+
+                entry.table.addSymbols(id, symbols);
+            }
+            catch(...)
+            {
+                release();
+                throw;
+            }
+        }
+
+        /**
+         * @brief Check local symbols of every unit against exports of other units.
+         * 
+         * Call once all units are populated.
+         * 
+         * @throw `std::domain_error` : Local symbol has same name as symbol exported by other unit.
+         */
+        inline void finalize() const
+        {
+            for(std::size_t id = 0; id < shards_.size(); ++id)
+            {
+                const auto& table = shards_[id]->table;
+
+                for(std::size_t i = 0; i < table.size(); ++i)
+                {
+                    if(table.isExport(i))
+                        continue;
+
+                    auto owner = findExport_(table.symbolName(i));
+
+                    if((owner != nullptr) && (*owner != static_cast<TranslationId>(id)))
+                        throw std::domain_error("Symbol name already exists, (either the existing symbol or new symbol is exported)");
+                }
+            }
+        }
+
+        /// @brief Stats of all shards combined.
+        inline SymbolTableStats getStats() const noexcept
+        {
+            SymbolTableStats stats = {};
+
+            for(const auto& entry : shards_)
+                stats += entry->table.getStats();
+
+            return stats;
+        }
+
+        /**
+         * @brief Lay sections of every unit out, then units one after another, setting base addresses of every shard.
+         * 
+         * Units are laid out in parallel, and their bases are exclusive scan of their sizes, 
+         * set one after another as each is a cheap store.
+         * 
+         * @param[in] codeBase address of code of first unit.
+         * @param[in] dataBase address of data of first unit.
+         */
+        inline void assignBaseAddresses(
+            std::size_t codeBase, 
+            std::size_t dataBase, 
+            std::size_t threadCount = impl_detail_::defaultThreadCount_()
+        )
+        {
+            std::vector<std::pair<std::size_t, std::size_t>> bases(shards_.size());
+
+            impl_detail_::parallelFor_(shards_.size(), threadCount, [&](std::size_t i)
+            {
+                shards_[i]->resolver.layoutSections();
+                bases[i] = {shards_[i]->resolver.getCodeSize(), shards_[i]->resolver.getDataSize()};
+            });
+
+            for(auto& [code, data] : bases)
+            {
+                auto codeSize = code;
+                auto dataSize = data;
+
+                code = codeBase;
+                data = dataBase;
+
+                codeBase += codeSize;
+                dataBase += dataSize;
+            }
+
+            for(std::size_t i = 0; i < shards_.size(); ++i)
+                shards_[i]->table.setBaseAddress(bases[i].first, bases[i].second);
+        }
+
+        /**
+         * @brief Place sections of every unit at their absolute address.
+         * 
+         * Call after `assignBaseAddresses`.
+         * 
+         * @return memory maps of code and data address space, regions named `<unit>:<section>`.
+         * @throw see `MemoryMap::place`, overlap or wrap around between units.
+         */
+        inline std::pair<MemoryMap, MemoryMap> buildMemoryMaps() const
+        {
+            constexpr std::size_t spaceSize = std::size_t(std::numeric_limits<typename IsaTraits::AddressType>::max()) + 1;
+
+            std::pair<MemoryMap, MemoryMap> maps = {MemoryMap(spaceSize), MemoryMap(spaceSize)};
+
+            for(std::size_t id = 0; id < shards_.size(); ++id)
+            {
+                const auto& entry = *shards_[id];
+                auto [codeBase, dataBase] = entry.table.getBaseAddress();
+
+                for(std::size_t i = 0; i < entry.resolver.sectionCount(); ++i)
+                {
+                    const auto& section = entry.resolver.getSection(i);
+                    auto name = std::to_string(id) + ":" + section.name;
+
+                    if(section.isCode())
+                        maps.first.place(codeBase + section.baseAddress, section.offset, name);
+                    else
+                        maps.second.place(dataBase + section.baseAddress, section.offset, name);
+                }
+            }
+
+            return maps;
+        }
+
+        /**
+         * @brief Resolve symbol referred from unit, local symbols first then exports.
+         * 
+         * Call once all units are populated.
+         * 
+         * @throw `std::invalid_argument` : Symbol not present in unit or exports.
+         * @throw see `SymbolTable::bind`.
+         */
+        inline typename IsaTraits::LargestType resolveSymbol(
+            TranslationId id, 
+            const SymbolReference& data
+        ) const
+        {
+            const auto& local = shard(id);
+
+            if(auto handle = local.tryBind(id, data))
+                return local.resolveSymbol(*handle);
+
+            auto owner = findExport_(data.name);
+
+            if(owner == nullptr)
+                throw std::invalid_argument("unidentified symbol");
+
+            return shard(*owner).resolveSymbol(*owner, data);
+        }
+    };
+}
+
+
+#endif // INCLUDE_GENASMLIB_SHARDEDSYMBOLTABLE_H_INCLUDED
+
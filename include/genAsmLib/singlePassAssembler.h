@@ -0,0 +1,321 @@
+/**
+ * @file singlePassAssembler.h 
+ * @author Harith Manoj (harithpub@gmail.com)
+ * @brief Single pass assembly into encoded words, with backpatching of fixups.
+ * @date 17 October 2026
+ * 
+ * @copyright Copyright (C) 2024
+ * 
+ * 
+ *                      APACHE LICENSE 2.0
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * 
+ */
+
+
+#ifndef INCLUDE_GENASMLIB_SINGLEPASSASSEMBLER_H_INCLUDED
+
+/// @brief include\genAsmLib\singlePassAssembler.h Header Guard 
+#define INCLUDE_GENASMLIB_SINGLEPASSASSEMBLER_H_INCLUDED
+
+#include <vector>
+#include <span>
+#include <stdexcept>
+
+#include "tokeniser.h"
+#include "symbolTable.h"
+
+namespace gen_asm
+{
+    /**
+     * @brief Check if type can supply lines of source.
+     * 
+     * Must Have:
+     * 
+     * @conceptMember{Methods}
+     * - `[bool] eof()`
+     * - `[std::string] read()`
+     */
+    template<class Reader>
+    concept LineReaderModel = requires(Reader& reader)
+    {
+        { reader.eof() } -> std::convertible_to<bool>;
+        { reader.read() } -> std::convertible_to<std::string_view>;
+    };
+
+    /**
+     * @brief Check if type can encode instructions into words.
+     * 
+     * Must Have:
+     * 
+     * @conceptMember{Methods}
+     * - `std::size_t encodeInstruction(IsaTraits::OpCodeType, std::span<const std::uint64_t> operands, std::span<IsaTraits::WordType> out)`
+     *      - Write encoding of instruction (with expansion of pseudo instructions) to out, return number of words written.
+     *      - out holds `getInstrWidthInBasic` words of op code.
+     *      - Throws `std::out_of_range` if an operand does not fit its field.
+     * - `[bool] isPcRelative(IsaTraits::OpCodeType) noexcept`
+     *      - Whether immediate of op code is a displacement from the next instruction.
+     */
+    template<class Traits, class IsaTraits>
+    concept EncoderTraitModel = requires(
+        const Traits& trait,
+        const typename IsaTraits::OpCodeType& op,
+        std::span<const std::uint64_t> operands,
+        std::span<typename IsaTraits::WordType> out
+    )
+    {
+        requires IsaTraitModel<IsaTraits>;
+
+        { trait.encodeInstruction(op, operands, out) } -> std::same_as<std::size_t>;
+        { trait.isPcRelative(op) } -> std::convertible_to<bool>;
+    };
+
+    /// @brief Words of a code section assembled by a unit.
+    template<IsaTraitModel IsaTraits>
+    struct SectionCode
+    {
+        /// @brief Index of section in `AddressResolver`.
+        std::size_t section;
+
+        /// @brief Offset in section of first word.
+        std::size_t offset;
+
+        std::vector<typename IsaTraits::WordType> words;
+    };
+
+    /**
+     * @brief Assemble translation unit in a single read of the source, into encoded words.
+     * 
+     * Instructions are encoded as soon as they are tokenized, into the buffer of their 
+     * code section. Instructions with symbol, local label or expression arguments depend on 
+     * section layout, so every one of them is recorded as a fixup over its words, and encoded 
+     * by `finishUnit` once sections are laid out and all symbols of the unit are defined.
+     * 
+     * Resolved reference arguments of pc relative op codes are targets, converted to 
+     * displacements from the instruction after them. Literal immediates are encoded as written.
+     * 
+     * Tokenizer traits must give operand patterns, see `OperandPatternTraitModel`.
+     * 
+     * @tparam EncoderTraits must satisfy EncoderTraitModel.
+     */
+    template<
+        IsaTraitModel IsaTraits, 
+        TokenizerTraitModel<IsaTraits> TokenizerTraits,
+        SymbolTraitModel<IsaTraits> SymbolTraits, 
+        AddressResolverModel<IsaTraits> AddressResolver,
+        EncoderTraitModel<IsaTraits> EncoderTraits
+    >
+    class SinglePassAssembler
+    {
+        using Table_ = SymbolTable<IsaTraits, SymbolTraits, AddressResolver>;
+
+        /// @brief Instruction waiting for layout, at offset of section.
+        struct Fixup_
+        {
+            std::size_t section;
+            std::size_t offset;
+            std::size_t width;
+            InstructionToken<IsaTraits> instr;
+        };
+
+        Tokenizer<IsaTraits, TokenizerTraits> tokenizer_;
+        EncoderTraits encoder_;
+        Table_& table_;
+        AddressResolver& resolver_;
+        typename SymbolTraits::TranslationId id_;
+
+        /// @brief Code of unit, indexed by section, empty for data sections.
+        std::vector<SectionCode<IsaTraits>> code_;
+        std::vector<Fixup_> fixups_;
+
+        inline SectionCode<IsaTraits>& sectionCode_(std::size_t section)
+        {
+            for(auto i = code_.size(); i <= section; ++i)
+                code_.push_back({i, resolver_.getSection(i).offset, {}});
+
+            return code_[section];
+        }
+
+        /// @brief Encode operands over width words of instruction at offset of section.
+        inline void encode_(
+            std::size_t section, 
+            std::size_t offset, 
+            std::size_t width,
+            typename IsaTraits::OpCodeType opCode, 
+            std::span<const std::uint64_t> operands
+        )
+        {
+            auto& code = code_[section];
+            auto words = std::span(code.words).subspan(offset - code.offset, width);
+
+            if(encoder_.encodeInstruction(opCode, operands, words) != width)
+                throw std::logic_error("Encoded width differs from instruction width");
+        }
+
+        /// @brief Extend buffers of code sections to their offsets, with fill regions reserved by directives.
+        inline void syncFills_()
+        {
+            for(std::size_t i = 0; i < resolver_.sectionCount(); ++i)
+            {
+                const auto& section = resolver_.getSection(i);
+
+                if(!section.isCode())
+                    continue;
+
+                auto& code = sectionCode_(i);
+                auto end = code.offset + code.words.size();
+
+                if(end >= section.offset)
+                    continue;
+
+                code.words.resize(section.offset - code.offset, 0);
+
+                for(const auto& region : section.fills)
+                {
+                    auto first = std::max<std::size_t>(region.offset, end);
+                    auto last = std::size_t(region.offset) + region.count;
+
+                    for(auto offset = first; offset < last; ++offset)
+                        code.words[offset - code.offset] = static_cast<typename IsaTraits::WordType>(region.value);
+                }
+            }
+        }
+
+        inline void emitInstruction_(const InstructionToken<IsaTraits>& instr)
+        {
+            auto section = resolver_.getCodeSection();
+            auto& code = sectionCode_(section);
+            std::size_t offset = resolver_.getCodeAddressOffset();
+
+            resolver_.updateOffsets(instr);
+
+            std::size_t width = resolver_.getCodeAddressOffset() - offset;
+            code.words.resize(code.words.size() + width, 0);
+
+            if(instr.symbolArgs.empty() && instr.localLabelArgs.empty() && instr.expressionArgs.empty())
+                encode_(section, offset, width, instr.opCode, instr.operands.view());
+            else
+                fixups_.push_back({section, offset, width, instr});
+        }
+
+    public:
+
+        template<class... Args>
+        inline SinglePassAssembler(
+            Table_& table, 
+            AddressResolver& resolver, 
+            typename SymbolTraits::TranslationId id, 
+            Args&&... args
+        ) 
+            : tokenizer_(std::forward<Args&&>(args)...), encoder_(), table_(table), resolver_(resolver), id_(id),
+            code_(), fixups_() {}
+
+        /**
+         * @brief Assemble one line of source.
+         * 
+         * @throw see `Tokenizer::tokenize`, `SymbolTable::addSymbol`, `AddressResolver::updateOffsets` 
+         * and `EncoderTraits::encodeInstruction`.
+         */
+        inline void assembleLine(std::string_view line)
+        {
+            tokenizer_.tokenize(line);
+
+            if(tokenizer_.isSymbol())
+                table_.addSymbol(id_, tokenizer_.getSymbol());
+            else if(tokenizer_.isInstruction())
+                emitInstruction_(tokenizer_.getInstruction());
+            else if(tokenizer_.isDirective())
+            {
+                resolver_.updateOffsets(tokenizer_.getDirective());
+                syncFills_();
+            }
+        }
+
+        /// @brief Assemble every remaining line of reader, then finish unit.
+        template<LineReaderModel Reader>
+        inline void assemble(Reader& reader)
+        {
+            while(!reader.eof())
+                assembleLine(reader.read());
+
+            finishUnit();
+        }
+
+        /**
+         * @brief Lay out sections, then resolve and encode every fixup.
+         * 
+         * @throw see `AddressResolver::layoutSections`, `SymbolTable::resolveOperands` 
+         * and `EncoderTraits::encodeInstruction`.
+         */
+        inline void finishUnit()
+        {
+            resolver_.layoutSections();
+
+            auto fixups = std::move(fixups_);
+            fixups_.clear();
+
+            auto codeBase = table_.getBaseAddress().first;
+
+            for(auto& [section, offset, width, instr] : fixups)
+            {
+                table_.resolveOperands(id_, instr);
+
+                if(encoder_.isPcRelative(instr.opCode))
+                {
+                    auto next = codeBase + resolver_.getSectionBase(section) + offset + 1;
+
+                    for(const auto& [position, reference] : instr.symbolArgs)
+                        instr.operands.values[position] -= next;
+
+                    for(const auto& [position, reference] : instr.localLabelArgs)
+                        instr.operands.values[position] -= next;
+
+                    for(const auto& [position, expression] : instr.expressionArgs)
+                        instr.operands.values[position] -= next;
+                }
+
+                encode_(section, offset, width, instr.opCode, instr.operands.view());
+            }
+        }
+
+        /// @brief Number of instructions waiting for `finishUnit`.
+        inline std::size_t pendingCount() const noexcept { return fixups_.size(); }
+
+        /// @brief Code of unit so far, indexed by section, words of fixups are zero until `finishUnit`.
+        inline const std::vector<SectionCode<IsaTraits>>& getOutput() const noexcept { return code_; }
+
+        /**
+         * @brief Take code of finished unit and start a new unit with id.
+         * 
+         * New unit continues sections where this unit left them.
+         * 
+         * @throw `std::logic_error` : Unit has fixups, `finishUnit` was not called.
+         */
+        inline std::vector<SectionCode<IsaTraits>> takeOutput(typename SymbolTraits::TranslationId nextId)
+        {
+            if(!fixups_.empty())
+                throw std::logic_error("Unit taken before finishUnit");
+
+            id_ = nextId;
+            tokenizer_.resetLocalLabels();
+
+            auto code = std::move(code_);
+            code_.clear();
+            return code;
+        }
+    };
+}
+
+
+#endif // INCLUDE_GENASMLIB_SINGLEPASSASSEMBLER_H_INCLUDED
@@ -0,0 +1,455 @@
+/**
+ * @file symbolImage.h 
+ * @author Harith Manoj (harithpub@gmail.com)
+ * @brief Flat, memory mappable symbol table image.
+ * @date 17 October 2026
+ * 
+ * @copyright Copyright (C) 2024
+ * 
+ * 
+ *                      APACHE LICENSE 2.0
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * 
+ */
+
+
+#ifndef INCLUDE_GENASMLIB_SYMBOLIMAGE_H_INCLUDED
+
+/// @brief include\genAsmLib\symbolImage.h Header Guard 
+#define INCLUDE_GENASMLIB_SYMBOLIMAGE_H_INCLUDED
+
+#include <span>
+#include <cstddef>
+#include <cstring>
+#include <optional>
+
+#include "symbolTable.h"
+
+namespace gen_asm
+{
+    namespace literal
+    {
+        /// @brief Magic number at start of symbol image ("GASY").
+        constexpr std::uint32_t SYMBOL_IMAGE_MAGIC = 0x59534147;
+
+        /// @brief Layout version of symbol image.
+        constexpr std::uint32_t SYMBOL_IMAGE_VERSION = 1;
+
+        /// @brief Written in native byte order, image from other byte order is rejected.
+        constexpr std::uint32_t SYMBOL_IMAGE_BYTE_ORDER = 0x01020304;
+
+        /// @brief End of hash bucket chain.
+        constexpr std::uint32_t SYMBOL_IMAGE_NO_RECORD = 0xFFFFFFFF;
+    }
+
+    /**
+     * @brief Header of symbol image, all offsets are in bytes from start of image.
+     * 
+     * Image layout : header, records, hash buckets, string pool, const payload pool. 
+     * Const payload pool is the deduplicated `ConstantPool` of table, symbols with identical values share a slice.
+     * Sections are 8 byte aligned and hold no pointers, image may be mapped at any address.
+     */
+    struct SymbolImageHeader
+    {
+        std::uint32_t magic;
+        std::uint32_t version;
+        std::uint32_t byteOrder;
+        std::uint32_t symbolCount;
+        std::uint64_t codeBaseAddress;
+        std::uint64_t dataBaseAddress;
+        std::uint64_t recordOffset;
+        std::uint64_t bucketOffset;
+        std::uint32_t bucketCount;
+        std::uint32_t stringSize;
+        std::uint64_t stringOffset;
+        std::uint64_t poolOffset;
+        std::uint64_t poolCount;
+    };
+
+    /// @brief Fixed size record of one symbol in image.
+    struct SymbolImageRecord
+    {
+        std::uint64_t translationUnitId;
+        std::uint32_t nameOffset;
+        std::uint32_t nameLength;
+        std::uint32_t nameHash;
+        std::uint32_t nextInBucket;
+        std::uint8_t symbolType;
+        std::uint8_t isExport;
+        std::uint16_t sizeType;
+        std::uint32_t sizeInBasic;
+        /// @brief code address offset for jump, data address offset for data, first pool index for const.
+        std::uint64_t value;
+        /// @brief element count for data and const.
+        std::uint64_t elementCount;
+    };
+
+    namespace impl_detail_
+    {
+        constexpr std::uint32_t fnv1a_(std::string_view str) noexcept
+        {
+            std::uint32_t hash = 2166136261u;
+            for(auto ch : str)
+            {
+                hash ^= static_cast<std::uint8_t>(ch);
+                hash *= 16777619u;
+            }
+            return hash;
+        }
+
+        constexpr std::size_t alignImage_(std::size_t size) noexcept
+        {
+            return (size + 7) & ~std::size_t(7);
+        }
+
+        template<class T>
+        inline T loadImage_(const std::byte* data) noexcept
+        {
+            T value;
+            std::memcpy(&value, data, sizeof(T));
+            return value;
+        }
+
+        template<class T>
+        inline void storeImage_(std::vector<std::byte>& image, std::size_t offset, const T& value) noexcept
+        {
+            std::memcpy(image.data() + offset, &value, sizeof(T));
+        }
+    }
+
+    /**
+     * @brief Serialize symbols, exports and base addresses of table to flat image.
+     * 
+     * @param[in] table symbol table to serialize.
+     * @param[in] traits symbol traits used to populate size of elements.
+     * @return image, suitable to write to file and map back with `SymbolImageView`.
+     * 
+     * @throw `std::length_error` : Table too large for 32 bit image indices.
+     */
+    template<
+        IsaTraitModel IsaTraits, 
+        SymbolTraitModel<IsaTraits> SymbolTraits, 
+        AddressResolverModel<IsaTraits> AddressResolver
+    >
+    inline std::vector<std::byte> serializeSymbolTable(
+        const SymbolTable<IsaTraits, SymbolTraits, AddressResolver>& table,
+        const SymbolTraits& traits = {}
+    )
+    {
+        static_assert(sizeof(typename IsaTraits::LargestType) <= sizeof(std::uint64_t), "Constant value does not fit image pool");
+
+        std::vector<SymbolImageRecord> records;
+        std::string strings;
+        auto pool = table.getConstantPool().values();
+
+        records.reserve(table.size());
+
+        for(std::size_t i = 0; i < table.size(); ++i)
+        {
+            SymbolImageRecord record = {};
+
+            std::visit(
+                [&](auto&& arg)
+                {
+                    using Symbol = std::decay_t<decltype(arg)>;
+
+                    record.translationUnitId = static_cast<std::uint64_t>(arg.translationUnitId);
+                    record.nameOffset = static_cast<std::uint32_t>(strings.size());
+                    record.nameLength = static_cast<std::uint32_t>(arg.symbolName.size());
+                    record.nameHash = impl_detail_::fnv1a_(arg.symbolName);
+                    record.isExport = arg.isExport;
+                    strings += arg.symbolName;
+
+                    if constexpr(std::same_as<Symbol, JumpSymbol<IsaTraits, SymbolTraits>>)
+                    {
+                        record.symbolType = static_cast<std::uint8_t>(SymbolType::JUMP);
+                        record.value = arg.codeAddressOffset;
+                    }
+                    else if constexpr(std::same_as<Symbol, DataSymbol<IsaTraits, SymbolTraits>>)
+                    {
+                        record.symbolType = static_cast<std::uint8_t>(SymbolType::DATA);
+                        record.sizeType = static_cast<std::uint16_t>(arg.sizeType);
+                        record.sizeInBasic = static_cast<std::uint32_t>(traits.getSizeInBasic(arg.sizeType));
+                        record.value = arg.dataAddressOffset;
+                        record.elementCount = arg.elementCount;
+                    }
+                    else
+                    {
+                        record.symbolType = static_cast<std::uint8_t>(SymbolType::CONST);
+                        record.sizeType = static_cast<std::uint16_t>(arg.sizeType);
+                        record.sizeInBasic = static_cast<std::uint32_t>(traits.getSizeInBasic(arg.sizeType));
+                        record.value = table.constantSlice(i).offset;
+                        record.elementCount = arg.init_value.size();
+                    }
+                }, table[i]
+            );
+
+            records.push_back(record);
+        }
+
+        if(records.size() >= literal::SYMBOL_IMAGE_NO_RECORD || strings.size() > 0xFFFFFFFF)
+            throw std::length_error("Symbol table too large for image");
+
+        std::size_t bucketCount = std::bit_ceil(std::max<std::size_t>(records.size(), 1));
+        std::vector<std::uint32_t> buckets(bucketCount, literal::SYMBOL_IMAGE_NO_RECORD);
+
+        for(std::size_t i = records.size(); i-- > 0; )
+        {
+            auto& bucket = buckets[records[i].nameHash & (bucketCount - 1)];
+            records[i].nextInBucket = bucket;
+            bucket = static_cast<std::uint32_t>(i);
+        }
+
+        SymbolImageHeader header = {};
+        header.magic = literal::SYMBOL_IMAGE_MAGIC;
+        header.version = literal::SYMBOL_IMAGE_VERSION;
+        header.byteOrder = literal::SYMBOL_IMAGE_BYTE_ORDER;
+        header.symbolCount = static_cast<std::uint32_t>(records.size());
+        header.codeBaseAddress = table.getBaseAddress().first;
+        header.dataBaseAddress = table.getBaseAddress().second;
+        header.recordOffset = impl_detail_::alignImage_(sizeof(SymbolImageHeader));
+        header.bucketOffset = impl_detail_::alignImage_(header.recordOffset + records.size() * sizeof(SymbolImageRecord));
+        header.bucketCount = static_cast<std::uint32_t>(bucketCount);
+        header.stringOffset = impl_detail_::alignImage_(header.bucketOffset + bucketCount * sizeof(std::uint32_t));
+        header.stringSize = static_cast<std::uint32_t>(strings.size());
+        header.poolOffset = impl_detail_::alignImage_(header.stringOffset + strings.size());
+        header.poolCount = pool.size();
+
+        std::vector<std::byte> image(header.poolOffset + pool.size() * sizeof(std::uint64_t));
+
+        impl_detail_::storeImage_(image, 0, header);
+        if(!records.empty())
+            std::memcpy(image.data() + header.recordOffset, records.data(), records.size() * sizeof(SymbolImageRecord));
+        std::memcpy(image.data() + header.bucketOffset, buckets.data(), buckets.size() * sizeof(std::uint32_t));
+        std::memcpy(image.data() + header.stringOffset, strings.data(), strings.size());
+        for(std::size_t i = 0; i < pool.size(); ++i)
+            impl_detail_::storeImage_(image, header.poolOffset + i * sizeof(std::uint64_t), static_cast<std::uint64_t>(pool[i]));
+
+        return image;
+    }
+
+    /**
+     * @brief Query symbol image in place, without parsing or allocation.
+     * 
+     * View does not own image, image must outlive view (e.g. mapped file).
+     */
+    class SymbolImageView
+    {
+        std::span<const std::byte> image_;
+        SymbolImageHeader header_;
+
+        inline std::uint32_t bucket_(std::size_t i) const noexcept
+        {
+            return impl_detail_::loadImage_<std::uint32_t>(image_.data() + header_.bucketOffset + i * sizeof(std::uint32_t));
+        }
+
+        inline std::uint64_t poolValue_(std::size_t i) const noexcept
+        {
+            return impl_detail_::loadImage_<std::uint64_t>(image_.data() + header_.poolOffset + i * sizeof(std::uint64_t));
+        }
+
+        /// @brief Check if count elements of elementSize bytes at offset lie within limit, without wrap around.
+        inline static bool fits_(std::uint64_t offset, std::uint64_t count, std::uint64_t elementSize, std::uint64_t limit) noexcept
+        {
+            return (offset <= limit) && (count <= (limit - offset) / elementSize);
+        }
+
+        inline static bool isIndex_(std::uint32_t index, std::uint32_t count) noexcept
+        {
+            return (index == literal::SYMBOL_IMAGE_NO_RECORD) || (index < count);
+        }
+
+        /// @throw `std::invalid_argument` : Field of record or bucket chain points outside image.
+        inline void validateRecords_() const
+        {
+            for(std::size_t i = 0; i < header_.symbolCount; ++i)
+            {
+                auto record = (*this)[i];
+
+                if(
+                    !fits_(record.nameOffset, record.nameLength, 1, header_.stringSize) ||
+                    !isIndex_(record.nextInBucket, header_.symbolCount) ||
+                    record.symbolType > static_cast<std::uint8_t>(SymbolType::CONST) ||
+                    (
+                        record.symbolType == static_cast<std::uint8_t>(SymbolType::CONST) && 
+                        !fits_(record.value, record.elementCount, 1, header_.poolCount)
+                    )
+                )
+                    throw std::invalid_argument("Symbol image record corrupt");
+            }
+
+            // Every record is in exactly one chain, so chains longer in total than symbol count hold a cycle.
+            std::uint64_t visited = 0;
+
+            for(std::size_t b = 0; b < header_.bucketCount; ++b)
+            {
+                auto i = bucket_(b);
+
+                if(!isIndex_(i, header_.symbolCount))
+                    throw std::invalid_argument("Symbol image bucket corrupt");
+
+                for(; i != literal::SYMBOL_IMAGE_NO_RECORD; i = (*this)[i].nextInBucket)
+                    if(++visited > header_.symbolCount)
+                        throw std::invalid_argument("Symbol image bucket corrupt");
+            }
+        }
+
+    public:
+
+        /**
+         * @brief Validate header, section bounds, every record and every bucket chain of image.
+         * 
+         * Image is checked once here, in time linear in its size, so that lookups on a corrupt 
+         * or truncated image cannot read outside it or loop.
+         * 
+         * @throw `std::invalid_argument` : Not a symbol image, unsupported version or byte order, truncated or corrupt.
+         */
+        inline SymbolImageView(std::span<const std::byte> image) : image_(image), header_()
+        {
+            if(image_.size() < sizeof(SymbolImageHeader))
+                throw std::invalid_argument("Symbol image truncated");
+
+            header_ = impl_detail_::loadImage_<SymbolImageHeader>(image_.data());
+
+            if(header_.magic != literal::SYMBOL_IMAGE_MAGIC)
+                throw std::invalid_argument("Not a symbol image");
+
+            if(header_.version != literal::SYMBOL_IMAGE_VERSION || header_.byteOrder != literal::SYMBOL_IMAGE_BYTE_ORDER)
+                throw std::invalid_argument("Unsupported symbol image version or byte order");
+
+            if(
+                header_.bucketCount == 0 || !std::has_single_bit(header_.bucketCount) ||
+                header_.symbolCount == literal::SYMBOL_IMAGE_NO_RECORD ||
+                !fits_(header_.recordOffset, header_.symbolCount, sizeof(SymbolImageRecord), image_.size()) ||
+                !fits_(header_.bucketOffset, header_.bucketCount, sizeof(std::uint32_t), image_.size()) ||
+                !fits_(header_.stringOffset, header_.stringSize, 1, image_.size()) ||
+                !fits_(header_.poolOffset, header_.poolCount, sizeof(std::uint64_t), image_.size())
+            )
+                throw std::invalid_argument("Symbol image truncated");
+
+            validateRecords_();
+        }
+
+        inline std::size_t size() const noexcept { return header_.symbolCount; }
+
+        inline std::pair<std::uint64_t, std::uint64_t> getBaseAddress() const noexcept 
+        { 
+            return {header_.codeBaseAddress, header_.dataBaseAddress}; 
+        }
+
+        inline SymbolImageRecord operator [] (std::size_t i) const noexcept
+        {
+            return impl_detail_::loadImage_<SymbolImageRecord>(image_.data() + header_.recordOffset + i * sizeof(SymbolImageRecord));
+        }
+
+        inline std::string_view name(const SymbolImageRecord& record) const noexcept
+        {
+            return std::string_view(
+                reinterpret_cast<const char*>(image_.data() + header_.stringOffset + record.nameOffset), 
+                record.nameLength
+            );
+        }
+
+        /**
+         * @brief Find symbol visible from translation unit, same rule as `SymbolTable`.
+         * 
+         * @return index of record, `std::nullopt` if not found.
+         */
+        inline std::optional<std::size_t> find(std::string_view name, std::uint64_t id) const noexcept
+        {
+            auto hash = impl_detail_::fnv1a_(name);
+
+            for(
+                auto i = bucket_(hash & (header_.bucketCount - 1)); 
+                i != literal::SYMBOL_IMAGE_NO_RECORD; 
+                i = (*this)[i].nextInBucket
+            )
+            {
+                auto record = (*this)[i];
+
+                if(record.nameHash == hash && this->name(record) == name)
+                {
+                    if(record.translationUnitId == id || record.isExport)
+                        return i;
+                }
+            }
+
+            return std::nullopt;
+        }
+
+        /**
+         * @brief Resolve symbol reference, same as `SymbolTable::resolveSymbol`.
+         * 
+         * @throw `std::invalid_argument` : Symbol not found, or jump symbol with non-zero subscripts.
+         * @throw `std::out_of_range` : Subscripts out of range of symbol.
+         */
+        inline std::uint64_t resolveSymbol(
+            std::uint64_t id, 
+            std::string_view name, 
+            std::size_t i = 0, 
+            std::size_t j = 0
+        ) const
+        {
+            auto index = find(name, id);
+
+            if(!index)
+                throw std::invalid_argument("unidentified symbol");
+
+            auto record = (*this)[*index];
+
+            if(record.symbolType == static_cast<std::uint8_t>(SymbolType::JUMP))
+            {
+                if(i != 0 || j != 0)
+                    throw std::invalid_argument("Jump symbols may not have non-zero subscripts");
+                
+                return header_.codeBaseAddress + record.value;
+            }
+
+            bool isDataLabel = (record.symbolType == static_cast<std::uint8_t>(SymbolType::DATA)) && (record.elementCount == 0);
+
+            if((i >= record.elementCount) && !(isDataLabel && (i == 0)))
+                throw std::out_of_range("Index out of range of array");
+
+            if(j >= record.sizeInBasic)
+                throw std::out_of_range("Index out of range for splitting element");
+
+            if(record.symbolType == static_cast<std::uint8_t>(SymbolType::DATA))
+                return header_.dataBaseAddress + record.value + (record.sizeInBasic * i) + j;
+            
+            auto shift = std::uint64_t(record.sizeInBasic) * j;
+            return (shift < 64) ? (poolValue_(record.value + i) >> shift) : 0;
+        }
+
+        /**
+         * @brief Value of element of const symbol.
+         * 
+         * @throw `std::out_of_range` : Not a const record of image, or index out of range of its elements.
+         */
+        inline std::uint64_t constValue(const SymbolImageRecord& record, std::size_t i) const
+        {
+            if(
+                record.symbolType != static_cast<std::uint8_t>(SymbolType::CONST) || 
+                !fits_(record.value, record.elementCount, 1, header_.poolCount) || 
+                i >= record.elementCount
+            )
+                throw std::out_of_range("Index out of range of array");
+
+            return poolValue_(record.value + i);
+        }
+    };
+}
+
+
+#endif // INCLUDE_GENASMLIB_SYMBOLIMAGE_H_INCLUDED
+
@@ -29,8 +29,15 @@
 #define INCLUDE_GENASMLIB_SYMBOLTABLE_H_INCLUDED
 
 #include <variant>
+#include <optional>
+#include <span>
+#include <unordered_map>
 
 #include "tokeniser.h"
+#include "constantPool.h"
+#include "bloomFilter.h"
+#include "symbolTableStats.h"
+#include "localLabelTable.h"
 
 
 namespace gen_asm
@@ -59,49 +66,105 @@ namespace gen_asm
         struct BasicSymbol_
         {
             typename SymbolTraits::TranslationId translationUnitId;
-            std::string symbolName;
+            std::string_view symbolName;
             bool isExport;
         };
 
     }
 
+    /*
+     * Symbol records are views materialised from columns of `SymbolTable`, 
+     * valid until next symbol is added.
+     */
 
     template<IsaTraitModel IsaTraits, SymbolTraitModel<IsaTraits> SymbolTraits>
     struct JumpSymbol : public impl_detail_::BasicSymbol_<IsaTraits, SymbolTraits>
     {
+        /// @brief Offset from code base of unit, including base of its section.
         typename IsaTraits::AddressType codeAddressOffset;
+        std::size_t section;
     };
 
     template<IsaTraitModel IsaTraits, SymbolTraitModel<IsaTraits> SymbolTraits>
     struct DataSymbol : public impl_detail_::BasicSymbol_<IsaTraits, SymbolTraits>
     {
+        /// @brief Offset from data base of unit, including base of its section.
         typename IsaTraits::AddressType dataAddressOffset;
         typename IsaTraits::BlockSizeType sizeType;
         std::size_t elementCount;
+        std::size_t section;
     };
 
     template<IsaTraitModel IsaTraits, SymbolTraitModel<IsaTraits> SymbolTraits>
     struct ConstSymbol : public impl_detail_::BasicSymbol_<IsaTraits, SymbolTraits>
     {
         typename IsaTraits::BlockSizeType sizeType;
-        std::vector<typename IsaTraits::LargestType> init_value;
+        std::span<const typename IsaTraits::LargestType> init_value;
+    };
+
+    /// @brief Symbol of batch added by `SymbolTable::addSymbols`.
+    template<IsaTraitModel IsaTraits>
+    struct BatchSymbol
+    {
+        SymbolToken<IsaTraits> symbol;
+
+        /// @brief Code address offset of jump symbol at its definition, unused for others.
+        typename IsaTraits::AddressType codeAddressOffset;
+
+        /// @brief Code section of jump symbol, `.text` if not given.
+        std::size_t codeSection;
+    };
+
+    /// @brief Transparent hash, lets string keyed containers be searched by `std::string_view` without allocation.
+    struct StringViewHash
+    {
+        using is_transparent = void;
+
+        inline std::size_t operator () (std::string_view str) const noexcept { return std::hash<std::string_view>{}(str); }
     };
 
     template<class Resolver, class IsaTraits>
     concept AddressResolverModel = requires(
         const Resolver& cres, Resolver& res,
         const SymbolToken<IsaTraits>& symbol,
-        const InstructionToken<IsaTraits>& instr
+        const InstructionToken<IsaTraits>& instr,
+        const DirectiveToken<IsaTraits>& directive,
+        std::size_t section
     )
     {
         requires IsaTraitModel<IsaTraits>;
 
         { cres.getCodeAddressOffset() } -> std::same_as<typename IsaTraits::AddressType>;
         { cres.getDataAddressOffset() } -> std::same_as<typename IsaTraits::AddressType>;
+        { cres.getCodeSection() } -> std::same_as<std::size_t>;
+        { cres.getDataSection() } -> std::same_as<std::size_t>;
+        { cres.getSectionBase(section) } -> std::same_as<typename IsaTraits::AddressType>;
+        { cres.getCodeSize() } -> std::same_as<std::size_t>;
+        { cres.getDataSize() } -> std::same_as<std::size_t>;
+        { res.layoutSections() };
         { res.updateOffsets(symbol) };
         { res.updateOffsets(instr) };
+        { res.updateOffsets(directive) };
     };
 
+    /**
+     * @brief Symbols of all translation units, stored as structure of arrays.
+     * 
+     * Name, translation unit, export flag and type of every symbol are kept in columns 
+     * scanned by lookups, type specific fields are kept in side tables indexed through 
+     * `sideIndices_`. Values of const symbols are interned in a `ConstantPool` shared by 
+     * all units, so identical tables are stored once.
+     * 
+     * Each translation unit carries a Bloom filter of its symbols, and the table a filter of 
+     * all exports and of all symbols, so lookups and conflict checks of names absent from 
+     * unit and exports skip the scan.
+     * 
+     * Jump and data symbols keep offsets within their section, resolved against section base 
+     * of address resolver, so sections may be laid out after symbols are added.
+     * 
+     * Numeric local labels are kept per unit apart from columns, they have no name to look up 
+     * and are only found by `LocalLabelReference`.
+     */
     template<
         IsaTraitModel IsaTraits, 
         SymbolTraitModel<IsaTraits> SymbolTraits, 
@@ -109,138 +172,362 @@ namespace gen_asm
     >
     class SymbolTable
     {
+    public:
+        using Record = std::variant<
+            JumpSymbol<IsaTraits, SymbolTraits>, 
+            DataSymbol<IsaTraits, SymbolTraits>, 
+            ConstSymbol<IsaTraits, SymbolTraits>
+        >;
+
+    private:
         AddressResolver& addressResolver_;
         SymbolTraits traitObj_;
 
-        using Var_t = std::variant<
-            JumpSymbol<SymbolTraits, IsaTraits>, 
-            DataSymbol<SymbolTraits, IsaTraits>, 
-            ConstSymbol<SymbolTraits, IsaTraits>
-        >;
+        struct JumpEntry_
+        {
+            typename IsaTraits::AddressType codeAddressOffset;
+            std::size_t section;
+        };
 
-        using SymbolList = std::vector<Var_t>;
+        struct DataEntry_
+        {
+            typename IsaTraits::AddressType dataAddressOffset;
+            typename IsaTraits::BlockSizeType sizeType;
+            std::size_t elementCount;
+            std::size_t section;
+        };
 
-        SymbolList symbols_;
+        struct ConstEntry_
+        {
+            typename IsaTraits::BlockSizeType sizeType;
+            ConstantSlice values;
+        };
+
+        std::vector<std::string> names_;
+        std::vector<typename SymbolTraits::TranslationId> translationIds_;
+        std::vector<bool> isExport_;
+        std::vector<SymbolType> types_;
+        std::vector<std::size_t> sideIndices_;
+
+        std::vector<JumpEntry_> jumpEntries_;
+        std::vector<DataEntry_> dataEntries_;
+        std::vector<ConstEntry_> constEntries_;
+        ConstantPool<typename IsaTraits::LargestType> constPool_;
+
+        std::unordered_map<typename SymbolTraits::TranslationId, LocalLabelDefinitions<JumpEntry_>> localLabels_;
+
+        std::unordered_map<typename SymbolTraits::TranslationId, BloomFilter> unitFilters_;
+        BloomFilter exportFilter_;
+        BloomFilter symbolFilter_;
 
         std::size_t codeBaseAddress_;
         std::size_t dataBaseAddress_;
 
-        const impl_detail_::BasicSymbol_<IsaTraits, SymbolTraits>& getLabelData(const Var_t& var) const
+        /// @brief Operation counters, updated by const lookups, safe to update concurrently.
+        mutable impl_detail_::SymbolTableCounters_ counters_;
+
+        inline bool unitMayContain_(typename SymbolTraits::TranslationId id, std::size_t hash) const noexcept
         {
-            return std::visit([](auto&& arg) -> const impl_detail_::BasicSymbol_<IsaTraits, SymbolTraits>& {return arg;}, var);
+            auto iter = unitFilters_.find(id);
+            return (iter != unitFilters_.end()) && iter->second.mayContain(hash);
         }
 
-        auto findSymbol_(std::string name, typename SymbolTraits::TranslationId id) const
+        std::size_t findSymbol_(std::string_view name, typename SymbolTraits::TranslationId id) const
         {
-            for(auto i = symbols_.begin(); i < symbols_.end(); ++i)
+            auto hash = BloomFilter::hash(name);
+
+            if(!exportFilter_.mayContain(hash) && !unitMayContain_(id, hash))
             {
-                const auto& labelData = getLabelData(*i);
+                counters_.recordFilterReject();
+                return names_.size();
+            }
+
+            std::size_t i = 0;
 
-                if(labelData.symbolName == name)
+            for(; i < names_.size(); ++i)
+            {
+                if(names_[i] == name)
                 {
-                    if((labelData.translationUnitId == id) || labelData.isExport)
-                        return i;
+                    if((translationIds_[i] == id) || isExport_[i])
+                        break;
                 }
             }
 
-            return symbols_.end();
+            counters_.recordLookup(std::min(i + 1, names_.size()), i != names_.size());
+
+            return i;
         }
 
-        void findIfSymbol_(const impl_detail_::BasicSymbol_<IsaTraits, SymbolTraits>& check) const
+        void findIfSymbol_(std::string_view name, typename SymbolTraits::TranslationId id, bool isExport) const
         {
-            for(const auto& label : symbols_)
-            {
-                const auto& labelData = getLabelData(label);
+            auto hash = BloomFilter::hash(name);
+
+            if(isExport ? !symbolFilter_.mayContain(hash) : (!exportFilter_.mayContain(hash) && !unitMayContain_(id, hash)))
+                return;
 
-                if(labelData.symbolName == check.symbolName)
+            for(std::size_t i = 0; i < names_.size(); ++i)
+            {
+                if(names_[i] == name)
                 {
-                    if(labelData.translationUnitId == check.translationUnitId)
+                    if(translationIds_[i] == id)
                         throw std::domain_error("Symbol name already exists in same translation unit");
                     
-                    if(labelData.isExport || check.isExport)
+                    if(isExport_[i] || isExport)
                         throw std::domain_error("Symbol name already exists, (either the existing symbol or new symbol is exported)");
                 }
             }
         }
-    
-        void addJumpSymbol_(typename SymbolTraits::TranslationId id, const SymbolToken<IsaTraits>& symbol)
+
+        void addColumns_(
+            typename SymbolTraits::TranslationId id, 
+            const SymbolToken<IsaTraits>& symbol, 
+            std::size_t sideIndex
+        )
         {
-            JumpSymbol<SymbolTraits, IsaTraits> entry = {};
+            names_.push_back(symbol.symbolName);
+            translationIds_.push_back(id);
+            isExport_.push_back(symbol.isExport);
+            types_.push_back(symbol.symbolType);
+            sideIndices_.push_back(sideIndex);
 
-            entry.symbolName = symbol.symbolName;
-            entry.translationUnitId = id;
-            entry.isExport = symbol.isExport;
-            entry.codeAddressOffset = addressResolver_.getCodeAddressOffset();
+            auto hash = BloomFilter::hash(symbol.symbolName);
 
-            findIfSymbol_(entry);
-            
-            symbols_.emplace_back(entry);
+            unitFilters_.try_emplace(id).first->second.add(hash);
+            symbolFilter_.add(hash);
+
+            if(symbol.isExport)
+                exportFilter_.add(hash);
+        }
+    
+        void addJumpSymbol_(
+            typename SymbolTraits::TranslationId id, 
+            const SymbolToken<IsaTraits>& symbol, 
+            typename IsaTraits::AddressType codeAddressOffset,
+            std::size_t section
+        )
+        {
+            jumpEntries_.push_back({codeAddressOffset, section});
+            addColumns_(id, symbol, jumpEntries_.size() - 1);
         }
 
         void addDataSymbol_(typename SymbolTraits::TranslationId id, const SymbolToken<IsaTraits>& symbol)
         {
-            DataSymbol<SymbolTraits, IsaTraits> entry = {};
-
-            entry.symbolName = symbol.symbolName;
-            entry.translationUnitId = id;
-            entry.isExport = symbol.isExport;
-            entry.sizeType = symbol.blockSizeCode;
-            entry.elementCount = symbol.init_value.size();
-            entry.dataAddressOffset = addressResolver_.getDataAddressOffset();
-
-            findIfSymbol_(entry);
+            auto offset = addressResolver_.getDataAddressOffset();
+            auto section = addressResolver_.getDataSection();
 
             addressResolver_.updateOffsets(symbol);
-            symbols_.emplace_back(entry);
+
+            dataEntries_.push_back({offset, symbol.blockSizeCode, symbol.elementCount, section});
+            addColumns_(id, symbol, dataEntries_.size() - 1);
         }
 
         void addConstSymbol_(typename SymbolTraits::TranslationId id, const SymbolToken<IsaTraits>& symbol)
         {
-            ConstSymbol<SymbolTraits, IsaTraits> entry = {};
+            constEntries_.push_back({symbol.blockSizeCode, constPool_.intern(symbol.init_value)});
+            addColumns_(id, symbol, constEntries_.size() - 1);
+        }
 
-            entry.symbolName = symbol.symbolName;
-            entry.translationUnitId = id;
-            entry.isExport = symbol.isExport;
-            entry.sizeType = symbol.blockSizeCode;
-            entry.init_value = symbol.init_value;
+        void append_(
+            typename SymbolTraits::TranslationId id, 
+            const SymbolToken<IsaTraits>& symbol, 
+            typename IsaTraits::AddressType codeAddressOffset,
+            std::size_t codeSection
+        )
+        {
+            switch (symbol.symbolType)
+            {
+            case SymbolType::JUMP:
+                addJumpSymbol_(id, symbol, codeAddressOffset, codeSection);
+                break;
+            case SymbolType::DATA:
+                addDataSymbol_(id, symbol);
+                break;
+            case SymbolType::LOCAL:
+                localLabels_[id].define(symbol.localLabelNumber, {codeAddressOffset, codeSection});
+                break;
+            default:
+                addConstSymbol_(id, symbol);
+                break;
+            }
+        }
 
-            findIfSymbol_(entry);
+        inline typename IsaTraits::AddressType jumpCodeOffset_(const JumpEntry_& entry) const noexcept
+        {
+            return addressResolver_.getSectionBase(entry.section) + entry.codeAddressOffset;
+        }
 
-            symbols_.emplace_back(entry);
+        inline typename IsaTraits::AddressType dataOffset_(const DataEntry_& entry) const noexcept
+        {
+            return addressResolver_.getSectionBase(entry.section) + entry.dataAddressOffset;
         }
 
+        class Iterator_
+        {
+            const SymbolTable* table_;
+            std::size_t index_;
+
+        public:
+            using value_type = Record;
+            using difference_type = std::ptrdiff_t;
+
+            inline Iterator_() noexcept : table_(nullptr), index_(0) {}
+            inline Iterator_(const SymbolTable* table, std::size_t index) noexcept : table_(table), index_(index) {}
+
+            inline Record operator * () const { return (*table_)[index_]; }
+
+            inline Iterator_& operator ++ () noexcept { ++index_; return *this; }
+            inline Iterator_ operator ++ (int) noexcept { auto copy = *this; ++index_; return copy; }
+
+            inline bool operator == (const Iterator_& other) const noexcept { return index_ == other.index_; }
+        };
+
     public:
 
         template<class... Args>
         inline SymbolTable(AddressResolver& addr, Args&&... args) 
-            : addressResolver_(addr), traitObj_(std::forward<Args&&>(args)...), symbols_({}), codeBaseAddress_(0), dataBaseAddress_(0) {}
+            : addressResolver_(addr), traitObj_(std::forward<Args&&>(args)...), 
+            names_(), translationIds_(), isExport_(), types_(), sideIndices_(),
+            jumpEntries_(), dataEntries_(), constEntries_(), constPool_(),
+            unitFilters_(), exportFilter_(literal::GLOBAL_BLOOM_BITS), symbolFilter_(literal::GLOBAL_BLOOM_BITS),
+            codeBaseAddress_(0), dataBaseAddress_(0), counters_() {}
         
-        inline auto begin() const { return symbols_.begin(); }
-        inline auto cbegin() const { return symbols_.cbegin(); }
+        inline auto begin() const { return Iterator_(this, 0); }
+        inline auto cbegin() const { return begin(); }
+
+        inline auto end() const { return Iterator_(this, size()); }
+        inline auto cend() const { return end(); }
+
+        inline std::size_t size() const noexcept { return names_.size(); }
+
+        inline std::string_view symbolName(std::size_t i) const noexcept { return names_[i]; }
+        inline typename SymbolTraits::TranslationId translationUnitId(std::size_t i) const noexcept { return translationIds_[i]; }
+        inline bool isExport(std::size_t i) const noexcept { return isExport_[i]; }
+        inline SymbolType symbolType(std::size_t i) const noexcept { return types_[i]; }
+
+        /// @brief Slice of constant pool holding values of const symbol `i`.
+        inline ConstantSlice constantSlice(std::size_t i) const noexcept { return constEntries_[sideIndices_[i]].values; }
 
-        inline auto end() const { return symbols_.end(); }
-        inline auto cend() const { return symbols_.cend(); }
+        inline const ConstantPool<typename IsaTraits::LargestType>& getConstantPool() const noexcept { return constPool_; }
 
-        inline std::size_t size() const noexcept { return symbols_.size(); }
-        inline const auto& operator [] (std::size_t i) const { return symbols_[i]; }
+        /// @brief Materialise record of symbol from columns.
+        inline Record operator [] (std::size_t i) const
+        {
+            impl_detail_::BasicSymbol_<IsaTraits, SymbolTraits> basic = {translationIds_[i], names_[i], isExport_[i]};
+            auto side = sideIndices_[i];
+
+            switch (types_[i])
+            {
+            case SymbolType::JUMP:
+                return JumpSymbol<IsaTraits, SymbolTraits>{
+                    basic, jumpCodeOffset_(jumpEntries_[side]), jumpEntries_[side].section
+                };
+            case SymbolType::DATA:
+                return DataSymbol<IsaTraits, SymbolTraits>{
+                    basic, dataOffset_(dataEntries_[side]), dataEntries_[side].sizeType, 
+                    dataEntries_[side].elementCount, dataEntries_[side].section
+                };
+            default:
+                return ConstSymbol<IsaTraits, SymbolTraits>{
+                    basic, constEntries_[side].sizeType, 
+                    constPool_.get(constEntries_[side].values)
+                };
+            }
+        }
 
         inline void addSymbol(
             typename SymbolTraits::TranslationId id, 
             const SymbolToken<IsaTraits>& symbol
         )
         {
-            switch (symbol.symbolType)
+            impl_detail_::ScopedTimer_ timer(counters_.addSymbolTime);
+
+            if(symbol.symbolType != SymbolType::LOCAL)
+                findIfSymbol_(symbol.symbolName, id, symbol.isExport);
+
+            append_(id, symbol, addressResolver_.getCodeAddressOffset(), addressResolver_.getCodeSection());
+        }
+
+        /**
+         * @brief Add all symbols of translation unit, checking conflicts in one pass.
+         * 
+         * Names of batch are hashed once, and existing symbols scanned once against them, 
+         * so loading a unit is linear in size of table and batch instead of quadratic.
+         * 
+         * Either all symbols are added or none. Data symbols of batch are first placed in a 
+         * copy of address resolver, so overflow or initial values in zero initialised section 
+         * are reported before anything is added.
+         * 
+         * @param[in] id translation unit of symbols.
+         * @param[in] symbols symbols in order of definition, with code address of jump symbols.
+         * 
+         * @throw `std::domain_error` : Every same unit or export conflict, one per line.
+         * @throw see `AddressResolver::updateOffsets` of data symbols.
+         */
+        inline void addSymbols(
+            typename SymbolTraits::TranslationId id, 
+            std::span<const BatchSymbol<IsaTraits>> symbols
+        )
+            requires std::copy_constructible<AddressResolver>
+        {
+            std::unordered_map<std::string_view, const BatchSymbol<IsaTraits>*> batch;
+            batch.reserve(symbols.size());
+
+            std::string conflicts;
+
+            auto report = [&](std::string_view message, std::string_view name)
             {
-            case SymbolType::JUMP:
-                addJumpSymbol_(id, symbol);
-                break;
-            case SymbolType::DATA:
-                addDataSymbol_(id, symbol);
-                break;
-            case SymbolType::CONST:
-                addConstSymbol_(id, symbol);
-                break;
+                conflicts += message;
+                conflicts += " : ";
+                conflicts += name;
+                conflicts += '\n';
+            };
+
+            for(const auto& entry : symbols)
+            {
+                if(entry.symbol.symbolType == SymbolType::LOCAL)
+                    continue;
+
+                if(!batch.try_emplace(entry.symbol.symbolName, &entry).second)
+                    report("Symbol name already exists in same translation unit", entry.symbol.symbolName);
+            }
+
+            for(std::size_t i = 0; i < names_.size(); ++i)
+            {
+                auto iter = batch.find(names_[i]);
+
+                if(iter == batch.end())
+                    continue;
+
+                if(translationIds_[i] == id)
+                    report("Symbol name already exists in same translation unit", names_[i]);
+                else if(isExport_[i] || iter->second->symbol.isExport)
+                    report("Symbol name already exists, (either the existing symbol or new symbol is exported)", names_[i]);
+            }
+
+            if(!conflicts.empty())
+            {
+                conflicts.pop_back();
+                throw std::domain_error(conflicts);
+            }
+
+            auto isData = [](const BatchSymbol<IsaTraits>& entry) { return entry.symbol.symbolType == SymbolType::DATA; };
+
+            if(std::ranges::any_of(symbols, isData))
+            {
+                AddressResolver probe = addressResolver_;
+
+                for(const auto& entry : symbols)
+                    if(isData(entry))
+                        probe.updateOffsets(entry.symbol);
             }
+
+            for(const auto& entry : symbols)
+                append_(id, entry.symbol, entry.codeAddressOffset, entry.codeSection);
+        }
+
+        inline bool contains(std::string_view name, typename SymbolTraits::TranslationId id) const
+        {
+            return findSymbol_(name, id) != names_.size();
         }
 
         inline void setBaseAddress(std::size_t code, std::size_t data) noexcept
@@ -251,60 +538,294 @@ namespace gen_asm
 
         inline std::pair<std::size_t, std::size_t> getBaseAddress() const noexcept { return {codeBaseAddress_, dataBaseAddress_}; }
 
-        inline typename IsaTraits::LargestType resolveSymbol(
+        /// @brief Memory use computed now, with operation counters since construction or `resetStats`.
+        inline SymbolTableStats getStats() const noexcept
+        {
+            SymbolTableStats stats{};
+            counters_.snapshot(stats);
+
+            stats.jumpSymbols = jumpEntries_.size();
+            stats.dataSymbols = dataEntries_.size();
+            stats.constSymbols = constEntries_.size();
+            stats.exportedSymbols = std::ranges::count(isExport_, true);
+
+            stats.nameBytes = 0;
+            for(const auto& name : names_)
+                stats.nameBytes += name.size();
+
+            stats.constPayloadBytes = constPool_.size() * sizeof(typename IsaTraits::LargestType);
+
+            stats.indexBytes = 
+                names_.capacity() * sizeof(std::string) + 
+                translationIds_.capacity() * sizeof(typename SymbolTraits::TranslationId) + 
+                isExport_.capacity() / 8 + 
+                types_.capacity() * sizeof(SymbolType) + 
+                sideIndices_.capacity() * sizeof(std::size_t) + 
+                jumpEntries_.capacity() * sizeof(JumpEntry_) + 
+                dataEntries_.capacity() * sizeof(DataEntry_) + 
+                constEntries_.capacity() * sizeof(ConstEntry_) + 
+                exportFilter_.sizeInBytes() + symbolFilter_.sizeInBytes();
+
+            for(const auto& [id, filter] : unitFilters_)
+                stats.indexBytes += sizeof(id) + filter.sizeInBytes();
+
+            return stats;
+        }
+
+        /// @brief Clear operation counters and timings.
+        inline void resetStats() const noexcept { counters_.reset(); }
+
+        /**
+         * @brief Bind symbol reference to handle if symbol is visible from unit, with a single lookup.
+         * 
+         * @return handle, empty if symbol is not found.
+         * @throw `std::invalid_argument` : Jump symbol with non-zero subscripts.
+         * @throw `std::out_of_range` : Subscripts out of range of symbol.
+         */
+        inline std::optional<SymbolHandle> tryBind(
             typename SymbolTraits::TranslationId id, 
-            const std::tuple<std::string, std::size_t, std::size_t>& data
-        )
+            const SymbolReference& data
+        ) const
         {
-            auto iter = findSymbol_(std::get<0>(data), id);
+            auto index = findSymbol_(data.name, id);
             
-            if(iter == symbols_.end())
-                throw std::invalid_argument("unidentified symbol");
+            if(index == names_.size())
+                return std::nullopt;
+
+            SymbolHandle handle = {};
+            handle.symbolIndex = index;
+
+            auto side = sideIndices_[index];
 
-            return std::visit(
-                [&](auto&& arg) -> typename IsaTraits::LargestType
+            switch (types_[index])
+            {
+            case SymbolType::JUMP:
+                if((data.index != 0) || (data.split != 0))
+                    throw std::invalid_argument("Jump symbols may not have non-zero subscripts");
+                break;
+
+            case SymbolType::DATA:
+                // Data symbol without elements names address after it, like a label of a following `.zero` or `.fill`.
+                if((data.index < dataEntries_[side].elementCount) || ((data.index == 0) && (dataEntries_[side].elementCount == 0)))
                 {
-                    if constexpr(std::same_as<JumpSymbol<SymbolTraits, IsaTraits>, std::decay_t<decltype(arg)>>)
-                    {
-                        if((std::get<1>(data) != 0) || (std::get<2>(data) != 0))
-                            throw std::invalid_argument("Jump symbols may not have non-zero subscripts");
-                        else
-                            return arg.codeAddressOffset;
-                    }
-                    else if constexpr(std::same_as<DataSymbol<SymbolTraits, IsaTraits>, std::decay_t<decltype(arg)>>)
-                    {
-                        if(std::get<1>(data) < arg.elementCount)
-                        {
-                            auto size = traitObj_.getSizeInBasic(arg.sizeType);
-                            if(std::get<2>(data) < size)
-                            {
-                                return dataBaseAddress_ + arg.dataAddressOffset + (size * std::get<1>(data)) + std::get<2>(data);
-                            }
-                            else
-                                throw std::out_of_range("Index out of range for splitting element");
-                        }
-                        else
-                            throw std::out_of_range("Index out of range of array");
-                    }
-                    else if constexpr(std::same_as<ConstSymbol<SymbolTraits, IsaTraits>, std::decay_t<decltype(arg)>>)
+                    auto size = traitObj_.getSizeInBasic(dataEntries_[side].sizeType);
+                    if(data.split < size)
+                        handle.offset = (size * data.index) + data.split;
+                    else
+                        throw std::out_of_range("Index out of range for splitting element");
+                }
+                else
+                    throw std::out_of_range("Index out of range of array");
+                break;
+
+            default:
+                if(data.index < constEntries_[side].values.count)
+                {
+                    auto size = traitObj_.getSizeInBasic(constEntries_[side].sizeType);
+                    if(data.split < size)
                     {
-                        if(std::get<1>(data) < arg.init_value.size())
-                        {
-                            auto size = traitObj_.getSizeInBasic(arg.sizeType);
-                            if(std::get<2>(data) < size)
-                            {
-                                return arg.init_value[std::get<1>(data)] >> (size * std::get<2>(data));
-                            }
-                            else
-                                throw std::out_of_range("Index out of range for splitting element");
-                        }
-                        else
-                            throw std::out_of_range("Index out of range of array");
+                        handle.offset = data.index;
+                        handle.shift = size * data.split;
                     }
+                    else
+                        throw std::out_of_range("Index out of range for splitting element");
+                }
+                else
+                    throw std::out_of_range("Index out of range of array");
+                break;
+            }
 
-                }, *iter
+            return handle;
+        }
+
+        /**
+         * @brief Bind symbol reference to handle, validating its subscripts once.
+         * 
+         * Handle stays valid as long as no symbols are removed, base addresses may change.
+         * 
+         * @throw `std::invalid_argument` : Symbol not found, or jump symbol with non-zero subscripts.
+         * @throw `std::out_of_range` : Subscripts out of range of symbol.
+         */
+        inline SymbolHandle bind(
+            typename SymbolTraits::TranslationId id, 
+            const SymbolReference& data
+        ) const
+        {
+            auto handle = tryBind(id, data);
+
+            if(!handle)
+                throw std::invalid_argument("unidentified symbol");
+
+            return *handle;
+        }
+
+        /**
+         * @brief Bind all symbol arguments of instruction, filling `instr.symbolHandles`.
+         * 
+         * @throw see `bind`.
+         */
+        inline void bind(
+            typename SymbolTraits::TranslationId id, 
+            InstructionToken<IsaTraits>& instr
+        ) const
+        {
+            instr.symbolHandles.clear();
+            instr.symbolHandles.reserve(instr.symbolArgs.size());
+
+            for(const auto& [position, data] : instr.symbolArgs)
+                instr.symbolHandles.push_back({position, bind(id, data)});
+        }
+
+        /// @brief Resolve bound symbol handle, no lookup or validation.
+        inline typename IsaTraits::LargestType resolveSymbol(const SymbolHandle& handle) const noexcept
+        {
+            auto side = sideIndices_[handle.symbolIndex];
+
+            switch (types_[handle.symbolIndex])
+            {
+            case SymbolType::JUMP:
+                return codeBaseAddress_ + jumpCodeOffset_(jumpEntries_[side]);
+            case SymbolType::DATA:
+                return dataBaseAddress_ + dataOffset_(dataEntries_[side]) + handle.offset;
+            default:
+                return constPool_[constEntries_[side].values.offset + handle.offset] >> handle.shift;
+            }
+        }
+
+        /**
+         * @brief Resolve symbol reference, no allocation.
+         * 
+         * @throw see `bind`.
+         */
+        inline typename IsaTraits::LargestType resolveSymbol(
+            typename SymbolTraits::TranslationId id, 
+            const SymbolReference& data
+        ) const
+        {
+            impl_detail_::ScopedTimer_ timer(counters_.resolveSymbolTime);
+
+            return resolveSymbol(bind(id, data));
+        }
+
+        /**
+         * @brief Resolve local label reference of unit to its code address.
+         * 
+         * @throw `std::invalid_argument` : Label has no definition referred.
+         */
+        inline typename IsaTraits::LargestType resolveLocalLabel(
+            typename SymbolTraits::TranslationId id, 
+            const LocalLabelReference& reference
+        ) const
+        {
+            auto iter = localLabels_.find(id);
+
+            if(iter == localLabels_.end())
+                throw std::invalid_argument("Reference to undefined local label");
+
+            return codeBaseAddress_ + jumpCodeOffset_(iter->second.find(reference));
+        }
+
+        inline typename IsaTraits::LargestType resolveExpression(
+            typename SymbolTraits::TranslationId id, 
+            const Expression<typename IsaTraits::LargestType>& expression
+        ) const
+        {
+            return expression.evaluate(
+                [&](const std::tuple<std::string, std::size_t, std::size_t>& data)
+                {
+                    return resolveSymbol(id, data);
+                },
+                [&](const LocalLabelReference& reference)
+                {
+                    return resolveLocalLabel(id, reference);
+                }
             );
         }
+
+        /**
+         * @brief Section and offset in section of jump symbol referred, empty if symbol is not a jump symbol.
+         * 
+         * @throw see `bind`.
+         */
+        inline std::optional<std::pair<std::size_t, std::size_t>> findCodeLabel(
+            typename SymbolTraits::TranslationId id, 
+            const SymbolReference& data
+        ) const
+        {
+            auto handle = bind(id, data);
+
+            if(types_[handle.symbolIndex] != SymbolType::JUMP)
+                return std::nullopt;
+
+            const auto& entry = jumpEntries_[sideIndices_[handle.symbolIndex]];
+            return std::pair<std::size_t, std::size_t>{entry.section, entry.codeAddressOffset};
+        }
+
+        /**
+         * @brief Section and offset in section of local label referred.
+         * 
+         * @throw see `resolveLocalLabel`.
+         */
+        inline std::pair<std::size_t, std::size_t> findCodeLabel(
+            typename SymbolTraits::TranslationId id, 
+            const LocalLabelReference& reference
+        ) const
+        {
+            auto iter = localLabels_.find(id);
+
+            if(iter == localLabels_.end())
+                throw std::invalid_argument("Reference to undefined local label");
+
+            const auto& entry = iter->second.find(reference);
+            return {entry.section, entry.codeAddressOffset};
+        }
+
+        /**
+         * @brief Move every jump symbol and local label of section, of all units, to offset 
+         * returned by mapping of its offset.
+         */
+        template<std::invocable<std::size_t> Mapping>
+        inline void relocateCodeLabels(std::size_t section, Mapping&& mapping)
+        {
+            auto relocate = [&](JumpEntry_& entry)
+            {
+                if(entry.section == section)
+                    entry.codeAddressOffset = static_cast<typename IsaTraits::AddressType>(mapping(entry.codeAddressOffset));
+            };
+
+            for(auto& entry : jumpEntries_)
+                relocate(entry);
+
+            for(auto& [id, definitions] : localLabels_)
+                definitions.forEach(relocate);
+        }
+
+        /**
+         * @brief Resolve symbol, local label and expression arguments of instruction into its fixed operands.
+         * 
+         * Symbol handles are used when `instr` is bound. Operands hold absolute values, 
+         * callers convert operands of pc relative op codes.
+         * 
+         * @throw see `bind` and `resolveLocalLabel`.
+         */
+        inline void resolveOperands(
+            typename SymbolTraits::TranslationId id, 
+            InstructionToken<IsaTraits>& instr
+        ) const
+        {
+            if(instr.symbolHandles.size() == instr.symbolArgs.size())
+                for(const auto& [position, handle] : instr.symbolHandles)
+                    instr.operands.set(position, resolveSymbol(handle));
+            else
+                for(const auto& [position, data] : instr.symbolArgs)
+                    instr.operands.set(position, resolveSymbol(id, data));
+
+            for(const auto& [position, reference] : instr.localLabelArgs)
+                instr.operands.set(position, resolveLocalLabel(id, reference));
+
+            for(const auto& [position, expression] : instr.expressionArgs)
+                instr.operands.set(position, resolveExpression(id, expression));
+        }
     };
 }
 
@@ -0,0 +1,314 @@
+/**
+ * @file symbolTableStats.h 
+ * @author Harith Manoj (harithpub@gmail.com)
+ * @brief Symbol table memory and operation statistics.
+ * @date 17 October 2026
+ * 
+ * @copyright Copyright (C) 2024
+ * 
+ * 
+ *                      APACHE LICENSE 2.0
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * 
+ */
+
+
+#ifndef INCLUDE_GENASMLIB_SYMBOLTABLESTATS_H_INCLUDED
+
+/// @brief include\genAsmLib\symbolTableStats.h Header Guard 
+#define INCLUDE_GENASMLIB_SYMBOLTABLESTATS_H_INCLUDED
+
+#include <array>
+#include <string>
+#include <cstdint>
+#include <chrono>
+#include <bit>
+#include <algorithm>
+#include <atomic>
+
+/*
+ * Define GEN_ASM_SYMBOL_TIMING to record timing histograms of `addSymbol` and `resolveSymbol`.
+ * Counters are always recorded, with relaxed atomics, as const lookups of one table may run 
+ * concurrently (`ShardedSymbolTable::resolveSymbol`).
+ * 
+ * `toJson` is written by `risc16::writeSymbolStats` of src/asm.cpp in builds with RISC_16_ASM_SYMBOL_TIMING, 
+ * no executable of this tree calls it yet, as src/asm.cpp has no entry point.
+ */
+
+namespace gen_asm
+{
+    /// @brief Histogram of durations, bucket `i` counts durations in `[2^(i-1), 2^i)` nanoseconds.
+    struct TimingHistogram
+    {
+        std::array<std::uint64_t, 32> buckets;
+        std::uint64_t totalNanoseconds;
+
+        inline void record(std::uint64_t nanoseconds) noexcept
+        {
+            ++buckets[std::min<std::size_t>(std::bit_width(nanoseconds), buckets.size() - 1)];
+            totalNanoseconds += nanoseconds;
+        }
+
+        inline TimingHistogram& operator += (const TimingHistogram& other) noexcept
+        {
+            for(std::size_t i = 0; i < buckets.size(); ++i)
+                buckets[i] += other.buckets[i];
+            totalNanoseconds += other.totalNanoseconds;
+            return *this;
+        }
+    };
+
+    /// @brief Memory use and operation counters of symbol table.
+    struct SymbolTableStats
+    {
+        std::size_t jumpSymbols;
+        std::size_t dataSymbols;
+        std::size_t constSymbols;
+        std::size_t exportedSymbols;
+
+        /// @brief Bytes of symbol name characters.
+        std::size_t nameBytes;
+        /// @brief Bytes of unique const payloads in constant pool.
+        std::size_t constPayloadBytes;
+        /// @brief Bytes of columns, side tables and filters.
+        std::size_t indexBytes;
+
+        std::uint64_t lookups;
+        std::uint64_t hits;
+        std::uint64_t misses;
+        /// @brief Lookups answered by Bloom filters without scanning.
+        std::uint64_t filterRejects;
+        /// @brief Rows visited by all lookups.
+        std::uint64_t probes;
+        std::uint64_t maxProbeLength;
+
+        TimingHistogram addSymbolTime;
+        TimingHistogram resolveSymbolTime;
+
+        inline SymbolTableStats& operator += (const SymbolTableStats& other) noexcept
+        {
+            jumpSymbols += other.jumpSymbols;
+            dataSymbols += other.dataSymbols;
+            constSymbols += other.constSymbols;
+            exportedSymbols += other.exportedSymbols;
+            nameBytes += other.nameBytes;
+            constPayloadBytes += other.constPayloadBytes;
+            indexBytes += other.indexBytes;
+            lookups += other.lookups;
+            hits += other.hits;
+            misses += other.misses;
+            filterRejects += other.filterRejects;
+            probes += other.probes;
+            maxProbeLength = std::max(maxProbeLength, other.maxProbeLength);
+            addSymbolTime += other.addSymbolTime;
+            resolveSymbolTime += other.resolveSymbolTime;
+            return *this;
+        }
+    };
+
+    namespace impl_detail_
+    {
+        inline void appendJson_(std::string& out, std::string_view key, std::uint64_t value, bool last = false)
+        {
+            out += '"';
+            out += key;
+            out += "\": ";
+            out += std::to_string(value);
+            out += last ? "" : ", ";
+        }
+
+        inline void appendJson_(std::string& out, std::string_view key, const TimingHistogram& histogram)
+        {
+            out += '"';
+            out += key;
+            out += "\": {\"totalNanoseconds\": ";
+            out += std::to_string(histogram.totalNanoseconds);
+            out += ", \"log2Buckets\": [";
+
+            for(std::size_t i = 0; i < histogram.buckets.size(); ++i)
+            {
+                out += std::to_string(histogram.buckets[i]);
+                out += (i + 1 == histogram.buckets.size()) ? "" : ", ";
+            }
+
+            out += "]}";
+        }
+
+        /// @brief `TimingHistogram` recorded through relaxed atomics, read as a snapshot.
+        class AtomicHistogram_
+        {
+            std::array<std::atomic<std::uint64_t>, std::tuple_size_v<decltype(TimingHistogram::buckets)>> buckets_;
+            std::atomic<std::uint64_t> totalNanoseconds_;
+
+        public:
+
+            inline AtomicHistogram_() noexcept : buckets_(), totalNanoseconds_(0) {}
+
+            inline AtomicHistogram_(const AtomicHistogram_& other) noexcept : AtomicHistogram_() { *this = other; }
+
+            inline AtomicHistogram_& operator = (const AtomicHistogram_& other) noexcept
+            {
+                for(std::size_t i = 0; i < buckets_.size(); ++i)
+                    buckets_[i].store(other.buckets_[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+                totalNanoseconds_.store(other.totalNanoseconds_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                return *this;
+            }
+
+            inline void record(std::uint64_t nanoseconds) noexcept
+            {
+                buckets_[std::min<std::size_t>(std::bit_width(nanoseconds), buckets_.size() - 1)].fetch_add(1, std::memory_order_relaxed);
+                totalNanoseconds_.fetch_add(nanoseconds, std::memory_order_relaxed);
+            }
+
+            inline TimingHistogram snapshot() const noexcept
+            {
+                TimingHistogram histogram{};
+
+                for(std::size_t i = 0; i < buckets_.size(); ++i)
+                    histogram.buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+                histogram.totalNanoseconds = totalNanoseconds_.load(std::memory_order_relaxed);
+
+                return histogram;
+            }
+
+            inline void reset() noexcept { *this = AtomicHistogram_(); }
+        };
+
+        /**
+         * @brief Operation counters of `SymbolTableStats`, as relaxed atomics so that concurrent 
+         * const lookups may count. Counts are exact, a snapshot taken during lookups may mix 
+         * counters from before and after one of them.
+         */
+        class SymbolTableCounters_
+        {
+            std::atomic<std::uint64_t> lookups_;
+            std::atomic<std::uint64_t> hits_;
+            std::atomic<std::uint64_t> misses_;
+            std::atomic<std::uint64_t> filterRejects_;
+            std::atomic<std::uint64_t> probes_;
+            std::atomic<std::uint64_t> maxProbeLength_;
+
+        public:
+
+            AtomicHistogram_ addSymbolTime;
+            AtomicHistogram_ resolveSymbolTime;
+
+            inline SymbolTableCounters_() noexcept 
+                : lookups_(0), hits_(0), misses_(0), filterRejects_(0), probes_(0), maxProbeLength_(0), 
+                addSymbolTime(), resolveSymbolTime() {}
+
+            inline SymbolTableCounters_(const SymbolTableCounters_& other) noexcept : SymbolTableCounters_() { *this = other; }
+
+            inline SymbolTableCounters_& operator = (const SymbolTableCounters_& other) noexcept
+            {
+                lookups_.store(other.lookups_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                hits_.store(other.hits_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                misses_.store(other.misses_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                filterRejects_.store(other.filterRejects_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                probes_.store(other.probes_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                maxProbeLength_.store(other.maxProbeLength_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                addSymbolTime = other.addSymbolTime;
+                resolveSymbolTime = other.resolveSymbolTime;
+                return *this;
+            }
+
+            /// @brief Count lookup answered by Bloom filters without scanning.
+            inline void recordFilterReject() noexcept
+            {
+                lookups_.fetch_add(1, std::memory_order_relaxed);
+                filterRejects_.fetch_add(1, std::memory_order_relaxed);
+                misses_.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            /// @brief Count lookup that visited probeLength rows.
+            inline void recordLookup(std::uint64_t probeLength, bool isHit) noexcept
+            {
+                lookups_.fetch_add(1, std::memory_order_relaxed);
+                probes_.fetch_add(probeLength, std::memory_order_relaxed);
+                (isHit ? hits_ : misses_).fetch_add(1, std::memory_order_relaxed);
+
+                auto max = maxProbeLength_.load(std::memory_order_relaxed);
+                while((max < probeLength) && !maxProbeLength_.compare_exchange_weak(max, probeLength, std::memory_order_relaxed));
+            }
+
+            /// @brief Copy counters and timings into stats, leaving memory use fields.
+            inline void snapshot(SymbolTableStats& stats) const noexcept
+            {
+                stats.lookups = lookups_.load(std::memory_order_relaxed);
+                stats.hits = hits_.load(std::memory_order_relaxed);
+                stats.misses = misses_.load(std::memory_order_relaxed);
+                stats.filterRejects = filterRejects_.load(std::memory_order_relaxed);
+                stats.probes = probes_.load(std::memory_order_relaxed);
+                stats.maxProbeLength = maxProbeLength_.load(std::memory_order_relaxed);
+                stats.addSymbolTime = addSymbolTime.snapshot();
+                stats.resolveSymbolTime = resolveSymbolTime.snapshot();
+            }
+
+            inline void reset() noexcept { *this = SymbolTableCounters_(); }
+        };
+
+        /// @brief Record duration of scope into histogram, no op unless GEN_ASM_SYMBOL_TIMING is defined.
+        class ScopedTimer_
+        {
+#ifdef GEN_ASM_SYMBOL_TIMING
+            AtomicHistogram_& histogram_;
+            std::chrono::steady_clock::time_point start_;
+
+        public:
+            inline ScopedTimer_(AtomicHistogram_& histogram) noexcept 
+                : histogram_(histogram), start_(std::chrono::steady_clock::now()) {}
+
+            inline ~ScopedTimer_()
+            {
+                histogram_.record(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_).count()
+                );
+            }
+#else
+        public:
+            inline ScopedTimer_(AtomicHistogram_&) noexcept {}
+#endif
+        };
+    }
+
+    /// @brief Format stats as single JSON object.
+    inline std::string toJson(const SymbolTableStats& stats)
+    {
+        std::string out = "{";
+
+        impl_detail_::appendJson_(out, "jumpSymbols", stats.jumpSymbols);
+        impl_detail_::appendJson_(out, "dataSymbols", stats.dataSymbols);
+        impl_detail_::appendJson_(out, "constSymbols", stats.constSymbols);
+        impl_detail_::appendJson_(out, "exportedSymbols", stats.exportedSymbols);
+        impl_detail_::appendJson_(out, "nameBytes", stats.nameBytes);
+        impl_detail_::appendJson_(out, "constPayloadBytes", stats.constPayloadBytes);
+        impl_detail_::appendJson_(out, "indexBytes", stats.indexBytes);
+        impl_detail_::appendJson_(out, "lookups", stats.lookups);
+        impl_detail_::appendJson_(out, "hits", stats.hits);
+        impl_detail_::appendJson_(out, "misses", stats.misses);
+        impl_detail_::appendJson_(out, "filterRejects", stats.filterRejects);
+        impl_detail_::appendJson_(out, "probes", stats.probes);
+        impl_detail_::appendJson_(out, "maxProbeLength", stats.maxProbeLength);
+        impl_detail_::appendJson_(out, "addSymbolTime", stats.addSymbolTime);
+        out += ", ";
+        impl_detail_::appendJson_(out, "resolveSymbolTime", stats.resolveSymbolTime);
+
+        out += "}";
+        return out;
+    }
+}
+
+
+#endif // INCLUDE_GENASMLIB_SYMBOLTABLESTATS_H_INCLUDED
+
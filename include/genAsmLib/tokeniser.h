@@ -35,10 +35,16 @@
 #include <vector>
 #include <ranges>
 #include <string>
+#include <array>
+#include <tuple>
+#include <span>
+#include <unordered_map>
 
 #include <easyParseLib/easyParse.h>
 #include <easyMathLib/easyMath.h>
 
+#include "expression.h"
+
 namespace gen_asm
 {
 
@@ -149,8 +155,72 @@ namespace gen_asm
         
         // Data type switches
         constexpr std::string_view ASCII_SWITCH = ".ascii";
+
+        // Directives
+
+        /// @brief Begin of every directive line.
+        constexpr char DIRECTIVE_BEGIN = '.';
+
+        constexpr std::string_view SECTION_DIRECTIVE = ".section";
+        constexpr std::string_view ORG_DIRECTIVE = ".org";
+        constexpr std::string_view ALIGN_DIRECTIVE = ".align";
+        constexpr std::string_view FILL_DIRECTIVE = ".fill";
+        constexpr std::string_view ZERO_DIRECTIVE = ".zero";
+
+        // Instruction limits
+
+        /// @brief Delimiters splitting instruction, space after op code and commas between arguments.
+        constexpr std::string_view INSTRUCTION_DELIMITERS = " ,";
+
+        /// @brief Maximum number of operands an operand pattern can describe.
+        constexpr std::size_t MAX_OPERAND_COUNT = 4;
     }
 
+    /// @brief Kind of operand expected at a position of an instruction.
+    enum class OperandKind : std::uint8_t
+    {
+        /// @brief No operand, marks end of operand pattern.
+        NONE,
+
+        /// @brief Register operand, prefixed by `%`.
+        REGISTER,
+
+        /// @brief Immediate operand, `$` prefixed number, `'c'` character or symbol reference.
+        IMMEDIATE,
+
+        /// @brief Symbol reference operand only.
+        SYMBOL,
+
+        /// @brief Instruction modifier operand.
+        MODIFIER
+    };
+
+    /// @brief Fixed list of operand kinds expected by an instruction, terminated by `OperandKind::NONE`.
+    using OperandPattern = std::array<OperandKind, literal::MAX_OPERAND_COUNT>;
+
+    /**
+     * @brief Model to check if tokenizer traits provide per op code operand patterns.
+     * 
+     * @tparam TokenizerTrait type to check.
+     * @tparam IsaTraits ISA trait class, must satisfy IsaTraitModel.
+     * 
+     * Must Have:
+     * 
+     * @conceptMember{Methods}
+     * - `const OperandPattern& getOperandPattern(IsaTraits::OpCodeType)`
+     *      - Operand kinds expected by the op code, in order.
+     * 
+     */
+    template<class TokenizerTrait, class IsaTraits>
+    concept OperandPatternTraitModel = requires(
+        const TokenizerTrait& trait, 
+        const typename IsaTraits::OpCodeType& op
+    )
+    {
+        requires IsaTraitModel<IsaTraits>;
+        { trait.getOperandPattern(op) } -> std::convertible_to<const OperandPattern&>;
+    };
+
     /// @brief Symbol type enumeration.
     enum class SymbolType
     {
@@ -162,7 +232,47 @@ namespace gen_asm
         DATA,
 
         /// @brief Encode data with assembly time constants.
-        CONST
+        CONST,
+
+        /// @brief Encode numeric local labels (`1:`), never entered into symbol table.
+        LOCAL
+    };
+
+    /// @brief Directive type enumeration.
+    enum class DirectiveType
+    {
+        /// @brief Switch following code or data to named section (`.section .rodata`).
+        SECTION,
+
+        /// @brief Place following code or data of current section at address relative to unit base (`.org 0x100`).
+        ORG,
+
+        /// @brief Pad current section with zeros to multiple of alignment (`.align 4`).
+        ALIGN,
+
+        /// @brief Reserve count units of current section holding value (`.fill 16, 0xFFFF`).
+        FILL,
+
+        /// @brief Reserve count zero units in current section (`.zero 256`).
+        ZERO
+    };
+
+    /**
+     * @brief Struct to encapsulate directive lines (lines beginning with `.`).
+     * 
+     * @tparam IsaTraits All ISA types.
+     */
+    template<IsaTraitModel IsaTraits>
+    struct DirectiveToken
+    {
+        /// @brief Type of directive.
+        DirectiveType directiveType;
+
+        /// @brief Name argument of directive, section name in case of section.
+        std::string name;
+
+        /// @brief Numeric arguments of directive, address of org, alignment of align, count (and value) of fill and zero.
+        std::vector<typename IsaTraits::LargestType> values;
     };
 
     /**
@@ -187,15 +297,90 @@ namespace gen_asm
 
         /// @brief Initial value of the data, in case of data, const
         std::vector<typename IsaTraits::LargestType> init_value;
+
+        /**
+         * @brief Number of elements in case of data, const.
+         * 
+         * Data keeps only the initial values given in `init_value`, remaining elements are zero, 
+         * so reserving large buffers costs no storage. Const and ascii data hold every element.
+         */
+        std::size_t elementCount;
+
+        /// @brief Number of label in case of local.
+        std::size_t localLabelNumber;
+    };
+
+    /// @brief Non owning reference to symbol `name[index][split]`, looked up without allocation.
+    struct SymbolReference
+    {
+        std::string_view name;
+        std::size_t index;
+        std::size_t split;
+
+        inline SymbolReference(std::string_view symbolName, std::size_t i = 0, std::size_t j = 0) noexcept
+            : name(symbolName), index(i), split(j) {}
+
+        /// @brief Refer to symbol argument of `InstructionToken`, which must outlive reference.
+        inline SymbolReference(const std::tuple<std::string, std::size_t, std::size_t>& data) noexcept
+            : name(std::get<0>(data)), index(std::get<1>(data)), split(std::get<2>(data)) {}
+    };
+
+    /// @brief Reference to symbol pre-resolved by `SymbolTable::bind`.
+    struct SymbolHandle
+    {
+        /// @brief Index of symbol in symbol table.
+        std::size_t symbolIndex;
+
+        /// @brief Offset from symbol address (jump, data) or element index (const), from subscripts.
+        std::size_t offset;
+
+        /// @brief Right shift of const element value, from secondary subscript.
+        std::size_t shift;
     };
 
     /// @brief Alias to describe a index - data pair, with data of type `T`.
     template<class T>
     using IndexedData = std::pair<std::size_t, T>;
 
+    /**
+     * @brief Operands of instruction in operand order, in a fixed array, as taken by per op code encoders.
+     * 
+     * Register, modifier and literal immediate operands hold their final value once tokenized. 
+     * Symbol, local label and expression operands are kept in their own lists of `InstructionToken`, 
+     * and hold their value once resolved, by `SymbolTable::resolveOperands` or `SinglePassAssembler`.
+     */
+    struct OperandValues
+    {
+        /// @brief Value of every operand (register code, modifier code or immediate), in operand order.
+        std::array<std::uint64_t, literal::MAX_OPERAND_COUNT> values;
+
+        /// @brief Number of operands.
+        std::size_t count;
+
+        /// @brief Bit `i` set once operand `i` holds its final value.
+        std::uint32_t resolvedMask;
+
+        inline void set(std::size_t position, std::uint64_t value) noexcept
+        {
+            values[position] = value;
+            resolvedMask |= std::uint32_t(1) << position;
+        }
+
+        inline bool isResolved(std::size_t position) const noexcept { return (resolvedMask >> position) & 1; }
+
+        inline bool isResolved() const noexcept { return resolvedMask == (std::uint32_t(1) << count) - 1; }
+
+        /// @brief Values in operand order.
+        inline std::span<const std::uint64_t> view() const noexcept { return {values.data(), count}; }
+    };
+
     /**
      * @brief Struct to encapsulate all tokenized elements of an instruction.
      * 
+     * With traits giving operand patterns, register, modifier and literal immediate operands 
+     * are parsed into `operands` only. `registerArgs`, `immediateArgs` and `modifierArgs` are 
+     * filled for traits without operand patterns.
+     * 
      * @tparam IsaTraits All ISA types.
      * 
      */
@@ -205,6 +390,9 @@ namespace gen_asm
         /// @brief op code of instruction.
         typename IsaTraits::OpCodeType opCode;
 
+        /// @brief All operands in operand order, filled when tokenizer traits give operand patterns.
+        OperandValues operands;
+
         /// @brief vector of all encoded register arguments and their position in argument list (0, n).
         std::vector<IndexedData<typename IsaTraits::RegisterCodeType>> registerArgs;
 
@@ -216,11 +404,24 @@ namespace gen_asm
 
         /// @brief vector of all encoded symbol arguments, their indices and their position in argument list (0, n).
         std::vector<IndexedData<std::tuple<std::string, std::size_t, std::size_t>>> symbolArgs;
+
+        /// @brief vector of handles bound to `symbolArgs` by `SymbolTable::bind`, and their position in argument list (0, n).
+        std::vector<IndexedData<SymbolHandle>> symbolHandles;
+
+        /// @brief vector of all numeric local label arguments and their position in argument list (0, n).
+        std::vector<IndexedData<LocalLabelReference>> localLabelArgs;
+
+        /// @brief vector of all expression arguments referring symbols and their position in argument list (0, n).
+        std::vector<IndexedData<Expression<typename IsaTraits::LargestType>>> expressionArgs;
     };
 
     /**
      * @brief Class to tokenize lines of assembly code.
      * 
+     * Definitions of numeric local labels are counted across calls to `tokenize`, also for 
+     * lines whose symbols are not tokenized, so each local label reference carries the index 
+     * of definition it refers to. Call `resetLocalLabels` before each pass over a translation unit.
+     * 
      * @tparam IsaTraits All ISA types.
      * @tparam TokenizerTraits Trait class for all necessary types and methods.
      * 
@@ -233,7 +434,12 @@ namespace gen_asm
         std::string_view strippedLineUnderEval_;
         SymbolToken<IsaTraits> symbolToken_;
         InstructionToken<IsaTraits> instructionToken_;
+        DirectiveToken<IsaTraits> directiveToken_;
         bool isSymbol_;
+        bool isDirective_;
+
+        /// @brief Number of definitions of each local label number seen in current unit.
+        std::unordered_map<std::size_t, std::size_t> localDefinitions_;
         std::size_t cursor_;
 
         inline void evaluateIsSymbol_() noexcept
@@ -273,72 +479,220 @@ namespace gen_asm
             return cursor_ >= strippedLineUnderEval_.size();
         }
 
-        inline void tokenizeInstruction_()
+        /// @brief Store final value of operand, into fixed operands when parsing by operand pattern.
+        template<bool isFixed, class T>
+        inline void store_(std::vector<IndexedData<T>>& args, std::size_t position, T value)
         {
+            if constexpr (isFixed)
+                instructionToken_.operands.set(position, static_cast<std::uint64_t>(value));
+            else
+                args.push_back({ position, value});
+        }
 
-            auto split = easyParse::splitUsingDelimiterList(strippedLineUnderEval_, {' ', ','});
+        template<bool isFixed>
+        inline void parseRegisterOperand_(std::size_t position, std::string_view arg)
+        {
+            if(arg[0] != '%')
+                throw std::invalid_argument("Expected register argument");
 
-            instructionToken_.opCode = traitObj_.resolveOpCode(split[0]);
-            
-            for(std::size_t i = 1; i < split.size(); ++i)
+            store_<isFixed>(instructionToken_.registerArgs, position, traitObj_.resolveRegister(arg.substr(1)));
+        }
+
+        template<bool isFixed>
+        inline void parseExpressionOperand_(std::size_t position, std::string_view arg)
+        {
+            auto expression = compileExpression<typename IsaTraits::LargestType>(arg);
+
+            for(auto& reference : expression.localLabels)
+                bindLocalLabel_(reference);
+
+            if(expression.isConstant())
+                store_<isFixed>(instructionToken_.immediateArgs, position, expression.postfix[0].value);
+            else
+                instructionToken_.expressionArgs.push_back({ position, std::move(expression)});
+        }
+
+        /**
+         * @brief Set index of definition referred by local label reference, from definitions seen so far.
+         * 
+         * @throw `std::invalid_argument` : Backward reference to label not defined yet.
+         */
+        inline void bindLocalLabel_(LocalLabelReference& reference) const
+        {
+            auto iter = localDefinitions_.find(reference.number);
+            std::size_t defined = (iter == localDefinitions_.end()) ? 0 : iter->second;
+
+            if(!reference.isForward && (defined == 0))
+                throw std::invalid_argument("Backward reference to undefined local label");
+
+            reference.definition = reference.isForward ? defined : (defined - 1);
+        }
+
+        /// @brief Count definition of local label if symbol of line is numeric, without tokenizing it.
+        inline void countLocalLabel_()
+        {
+            auto name = easyParse::stripWhiteSpace(strippedLineUnderEval_.substr(0, cursor_));
+
+            if(!name.empty() && easyParse::validateDecString(name))
+                ++localDefinitions_[convertLocalLabelNumber(name)];
+        }
+
+        inline void parseLocalLabelOperand_(std::size_t position, std::string_view arg)
+        {
+            bool isForward = (arg.back() == literal::LOCAL_FORWARD_SUFFIX);
+
+            if(!isForward && (arg.back() != literal::LOCAL_BACKWARD_SUFFIX))
+                throw std::invalid_argument("Local label reference must end with \'f\' or \'b\'");
+
+            LocalLabelReference reference = { convertLocalLabelNumber(arg.substr(0, arg.size() - 1)), isForward, 0 };
+            bindLocalLabel_(reference);
+            instructionToken_.localLabelArgs.push_back({position, reference});
+        }
+
+        template<bool isFixed>
+        inline void parseSymbolOperand_(std::size_t position, std::string_view arg)
+        {
+            if(isExpressionOperand(arg))
+                return parseExpressionOperand_<isFixed>(position, arg);
+
+            if(easyParse::isDecDigit(arg[0]))
+                return parseLocalLabelOperand_(position, arg);
+
+            auto indexBegin = arg.find_first_of('[');
+            auto symbol = arg.substr(0, indexBegin);
+
+            std::size_t indexPrimary = 0;
+            std::size_t indexSecondary = 0;
+            std::string symbolName = static_cast<std::string>(symbol);
+
+            if(indexBegin != arg.npos)
             {
-                auto arg = easyParse::stripWhiteSpace(split[i]);
+                auto indexEnd = arg.find_first_of(']', indexBegin);
+                auto index = arg.substr(indexBegin + 1, indexEnd - indexBegin - 1);
+                
+                if(index.empty())
+                    throw std::invalid_argument("Symbol index empty");
                 
-                if(arg.empty())
-                    throw std::invalid_argument("Empty argument to instruction");
+                indexPrimary = impl_detail_::parseWholeNumber_<std::size_t>(index, "symbol index");
+
+                indexBegin = easyParse::advanceOverWhiteSpace(arg, indexEnd + 1);
                 
-                if(arg[0] == '%')
-                    instructionToken_.registerArgs.push_back({ i - 1, traitObj_.resolveRegister(arg.substr(1))});
-                else if(arg[0] == '$')
-                    instructionToken_.immediateArgs.push_back({ i - 1, easyParse::convertNumberString<typename IsaTraits::LargestType>(arg.substr(1))});
-                else if((arg[0] == '\'') && (arg.back() == '\'') && (arg.size() > 2))
+                if(indexBegin < arg.size())
                 {
-                    if(arg.size() == 3)
-                        instructionToken_.immediateArgs.push_back({ i - 1, arg[1]});
-                    else
-                        instructionToken_.immediateArgs.push_back({ i - 1, easyParse::convertEscapedString(arg.substr(1, arg.size() - 2))});
+                    if(arg[indexBegin] != '[')
+                        throw std::invalid_argument("Unexpected character after first index of symbol");
+
+                    if(arg.back() != ']')
+                        throw std::invalid_argument("Unexpected character at end of symbol argument");
+                    
+                    index = arg.substr(indexBegin + 1, arg.size() - indexBegin - 2);
+
+                    if(index.empty())
+                        throw std::invalid_argument("Symbol index empty");
+
+                    indexSecondary = impl_detail_::parseWholeNumber_<std::size_t>(index, "symbol index");
                 }
-                else if(traitObj_.checkIfModifier(arg))
-                    instructionToken_.modifierArgs.push_back({ i - 1, traitObj_.resolveModifier(arg)});
+            }
+        
+            instructionToken_.symbolArgs.push_back({position, {symbolName, indexPrimary, indexSecondary}});
+        }
+
+        template<bool isFixed>
+        inline void parseImmediateOperand_(std::size_t position, std::string_view arg)
+        {
+            using LargestType = typename IsaTraits::LargestType;
+
+            if((arg[0] == '$') && isExpressionOperand(arg.substr(1)))
+                parseExpressionOperand_<isFixed>(position, arg.substr(1));
+            else if(arg[0] == '$')
+                store_<isFixed>(instructionToken_.immediateArgs, position, impl_detail_::parseWholeNumber_<LargestType>(arg.substr(1), "immediate"));
+            else if((arg[0] == '\'') && (arg.back() == '\'') && (arg.size() > 2))
+            {
+                if(arg.size() == 3)
+                    store_<isFixed>(instructionToken_.immediateArgs, position, static_cast<LargestType>(arg[1]));
                 else
+                    store_<isFixed>(
+                        instructionToken_.immediateArgs, position, 
+                        static_cast<LargestType>(easyParse::convertEscapedString(arg.substr(1, arg.size() - 2)))
+                    );
+            }
+            else
+                parseSymbolOperand_<isFixed>(position, arg);
+        }
+
+        template<bool isFixed>
+        inline void parseModifierOperand_(std::size_t position, std::string_view arg)
+        {
+            if(!traitObj_.checkIfModifier(arg))
+                throw std::invalid_argument("Expected modifier argument");
+
+            store_<isFixed>(instructionToken_.modifierArgs, position, traitObj_.resolveModifier(arg));
+        }
+
+        inline void parseNoOperand_(std::size_t, std::string_view)
+        {
+            throw std::invalid_argument("Too many arguments to instruction");
+        }
+
+        using OperandParser_ = void (Tokenizer::*)(std::size_t, std::string_view);
+
+        /// @brief Operand parse routines indexed by `OperandKind`, parsing into fixed operands.
+        static constexpr std::array<OperandParser_, 5> operandParsers_ = {
+            &Tokenizer::parseNoOperand_,
+            &Tokenizer::parseRegisterOperand_<true>,
+            &Tokenizer::parseImmediateOperand_<true>,
+            &Tokenizer::parseSymbolOperand_<true>,
+            &Tokenizer::parseModifierOperand_<true>
+        };
+
+        inline void tokenizeInstruction_()
+        {
+
+            auto split = easyParse::QuotedSplitView(strippedLineUnderEval_, literal::INSTRUCTION_DELIMITERS);
+            auto iterator = split.begin();
+
+            instructionToken_.opCode = traitObj_.resolveOpCode(*iterator);
+
+            std::size_t position = 0;
+
+            if constexpr (OperandPatternTraitModel<TokenizerTraits, IsaTraits>)
+            {
+                const OperandPattern& pattern = traitObj_.getOperandPattern(instructionToken_.opCode);
+
+                for(++iterator; iterator != split.end(); ++iterator, ++position)
                 {
-                    auto indexBegin = arg.find_first_of('[');
-                    auto symbol = arg.substr(0, indexBegin);
-
-                    std::size_t indexPrimary = 0;
-                    std::size_t indexSecondary = 0;
-                    std::string symbolName = static_cast<std::string>(symbol);
-
-                    if(indexBegin != arg.npos)
-                    {
-                        auto indexEnd = arg.find_first_of(']', indexBegin);
-                        auto index = arg.substr(indexBegin + 1, indexEnd - indexBegin - 1);
-                        
-                        if(index.empty())
-                            throw std::invalid_argument("Symbol index empty");
-                        
-                        indexPrimary = easyParse::convertNumberString<std::size_t>(index);
-
-                        indexBegin = easyParse::advanceOverWhiteSpace(arg, indexEnd + 1);
-                        
-                        if(indexBegin < arg.size())
-                        {
-                            if(arg[indexBegin] != '[')
-                                throw std::invalid_argument("Unexpected character after first index of symbol");
-
-                            if(arg.back() != ']')
-                                throw std::invalid_argument("Unexpected character at end of symbol argument");
-                            
-                            index = arg.substr(indexBegin + 1, arg.size() - indexBegin - 2);
-
-                            if(index.empty())
-                                throw std::invalid_argument("Symbol index empty");
-
-                            indexSecondary = easyParse::convertNumberString<std::size_t>(index);
-                        }
-                    }
-                
-                    instructionToken_.symbolArgs.push_back({i - 1, {symbolName, indexPrimary, indexSecondary}});
+                    auto arg = easyParse::stripWhiteSpace(*iterator);
+                    
+                    if(arg.empty())
+                        throw std::invalid_argument("Empty argument to instruction");
+
+                    auto kind = (position < pattern.size()) ? pattern[position] : OperandKind::NONE;
+                    
+                    (this->*operandParsers_[static_cast<std::size_t>(kind)])(position, arg);
+                }
+
+                if((position < pattern.size()) && (pattern[position] != OperandKind::NONE))
+                    throw std::invalid_argument("Too few arguments to instruction");
+
+                instructionToken_.operands.count = position;
+            }
+            else
+            {
+                for(++iterator; iterator != split.end(); ++iterator, ++position)
+                {
+                    auto arg = easyParse::stripWhiteSpace(*iterator);
+                    
+                    if(arg.empty())
+                        throw std::invalid_argument("Empty argument to instruction");
+                    
+                    if(arg[0] == '%')
+                        parseRegisterOperand_<false>(position, arg);
+                    else if((arg[0] == '$') || ((arg[0] == '\'') && (arg.back() == '\'') && (arg.size() > 2)))
+                        parseImmediateOperand_<false>(position, arg);
+                    else if(traitObj_.checkIfModifier(arg))
+                        parseModifierOperand_<false>(position, arg);
+                    else
+                        parseSymbolOperand_<false>(position, arg);
                 }
             }
         }
@@ -363,6 +717,65 @@ namespace gen_asm
             }
         }
 
+        inline void tokenizeDirective_()
+        {
+            auto end = easyParse::findFirstWhiteSpace(strippedLineUnderEval_, 0);
+            auto keyword = strippedLineUnderEval_.substr(0, end);
+
+            auto argument = (end == strippedLineUnderEval_.npos) ? 
+                std::string_view() 
+                : easyParse::stripWhiteSpace(strippedLineUnderEval_.substr(end));
+
+            if(keyword == literal::SECTION_DIRECTIVE)
+            {
+                directiveToken_.directiveType = DirectiveType::SECTION;
+
+                if(argument.empty() || (easyParse::findFirstWhiteSpace(argument, 0) != argument.npos))
+                    throw std::invalid_argument("Section directive requires exactly one section name");
+
+                directiveToken_.name = argument;
+            }
+            else if(keyword == literal::ORG_DIRECTIVE)
+            {
+                directiveToken_.directiveType = DirectiveType::ORG;
+                parseDirectiveValues_(argument, 1, 1);
+            }
+            else if(keyword == literal::ALIGN_DIRECTIVE)
+            {
+                directiveToken_.directiveType = DirectiveType::ALIGN;
+                parseDirectiveValues_(argument, 1, 1);
+
+                if(!easyMath::isPowerOfTwo(directiveToken_.values[0]))
+                    throw std::invalid_argument("Alignment must be a power of two");
+            }
+            else if(keyword == literal::FILL_DIRECTIVE)
+            {
+                directiveToken_.directiveType = DirectiveType::FILL;
+                parseDirectiveValues_(argument, 2, 2);
+            }
+            else if(keyword == literal::ZERO_DIRECTIVE)
+            {
+                directiveToken_.directiveType = DirectiveType::ZERO;
+                parseDirectiveValues_(argument, 1, 1);
+            }
+            else
+                throw std::invalid_argument("Unknown directive");
+        }
+
+        inline void parseDirectiveValues_(std::string_view argument, std::size_t minCount, std::size_t maxCount)
+        {
+            if(!argument.empty())
+                for(auto element : easyParse::SplitView(argument, ","))
+                    directiveToken_.values.push_back(
+                        impl_detail_::parseWholeNumber_<typename IsaTraits::LargestType>(
+                            easyParse::stripWhiteSpace(element), "directive value"
+                        )
+                    );
+
+            if((directiveToken_.values.size() < minCount) || (directiveToken_.values.size() > maxCount))
+                throw std::invalid_argument("Invalid number of directive arguments");
+        }
+
         inline void tokenizeSymbol_()
         {
 
@@ -374,6 +787,20 @@ namespace gen_asm
             );
 
 
+            if(!symbolToken_.symbolName.empty() && easyParse::validateDecString(symbolToken_.symbolName))
+            {
+                symbolToken_.symbolType = SymbolType::LOCAL;
+                symbolToken_.localLabelNumber = convertLocalLabelNumber(symbolToken_.symbolName);
+                advanceCursor(1);
+
+                if(!invalidCursor())
+                    throw std::invalid_argument("Local labels may not have switches");
+
+                ++localDefinitions_[symbolToken_.localLabelNumber];
+
+                return;
+            }
+
             validateSymbolName_();
 
             advanceCursor(1);
@@ -413,7 +840,7 @@ namespace gen_asm
             }
             else if(strippedLineUnderEval_[cursor_] == '.')
             {
-                auto end = strippedLineUnderEval_.find_first_of(easyParse::WHITESPACE_STRING, cursor_);
+                auto end = easyParse::findFirstWhiteSpace(strippedLineUnderEval_, cursor_);
                 auto sizeString = easyParse::stripWhiteSpace(strippedLineUnderEval_.substr(
                     cursor_, 
                     (end == strippedLineUnderEval_.npos)? 
@@ -442,12 +869,16 @@ namespace gen_asm
                 if(end == strippedLineUnderEval_.npos)  
                     throw std::invalid_argument("Expected \']\'");
                 
-                auto elementCount = easyParse::convertNumberString<std::size_t>(
-                    strippedLineUnderEval_.substr(cursor_, end - cursor_)
+                auto elementCount = impl_detail_::parseWholeNumber_<std::size_t>(
+                    strippedLineUnderEval_.substr(cursor_, end - cursor_), "element count"
                 );
 
                 cursor_ = end + 1;
-                symbolToken_.init_value.resize(elementCount);
+                symbolToken_.elementCount = elementCount;
+
+                if(symbolToken_.symbolType == SymbolType::CONST)
+                    symbolToken_.init_value.resize(elementCount);
+
                 advanceCursor(0);
             }
 
@@ -464,18 +895,26 @@ namespace gen_asm
 
             if(symbolToken_.blockSizeCode != literal::ASCII_DATA)
             {
-                auto splitData = easyParse::splitUsingDelimiterList(strippedLineUnderEval_.substr(cursor_), {','});
+                std::size_t i = 0;
+
+                for(auto element : easyParse::SplitView(strippedLineUnderEval_.substr(cursor_), ","))
+                {
+                    if(i >= symbolToken_.elementCount)
+                        break;
 
+                    auto value = impl_detail_::parseWholeNumber_<typename IsaTraits::LargestType>(
+                        easyParse::stripWhiteSpace(element), "initial value"
+                    );
 
-                auto min = easyMath::min({symbolToken_.init_value.size(), splitData.size()});
+                    if(symbolToken_.symbolType == SymbolType::DATA)
+                        symbolToken_.init_value.push_back(value);
+                    else
+                        symbolToken_.init_value[i] = value;
 
-                for(std::size_t i = 0; i < min; ++i)
-                    symbolToken_.init_value[i] 
-                        = easyParse::convertNumberString<typename IsaTraits::LargestType>(
-                            easyParse::stripWhiteSpace(splitData[i])
-                        );
+                    ++i;
+                }
                 
-                for(std::size_t i = min; i < symbolToken_.init_value.size(); ++i)
+                for(; i < symbolToken_.init_value.size(); ++i)
                     symbolToken_.init_value[i] = 0;
             }
             else
@@ -497,6 +936,7 @@ namespace gen_asm
                 }
 
                 symbolToken_.init_value.push_back('\0');
+                symbolToken_.elementCount = symbolToken_.init_value.size();
             }
         }
 
@@ -509,27 +949,41 @@ namespace gen_asm
         {
             instructionToken_ = {};
             symbolToken_ = {};
+            directiveToken_ = {};
 
             strippedLineUnderEval_ = easyParse::stripCommentsAndWhiteSpace(line, ';');
+            isDirective_ = !isBlank() && (strippedLineUnderEval_[0] == literal::DIRECTIVE_BEGIN);
             
-            if(!isBlank())
+            if(isDirective_)
+            {
+                isSymbol_ = false;
+                tokenizeDirective_();
+            }
+            else if(!isBlank())
             {
                 evaluateIsSymbol_();
                 if(isInstruction())
                     tokenizeInstruction_();
                 else if(isSymbol() && shouldTokenizeSymbol)
                     tokenizeSymbol_();
+                else if(isSymbol())
+                    countLocalLabel_();
             }
         }
 
+        /// @brief Forget local label definitions counted, at start of each pass over a translation unit.
+        inline void resetLocalLabels() noexcept { localDefinitions_.clear(); }
+
         inline bool isBlank() const noexcept { return strippedLineUnderEval_.empty(); }
         inline bool isSymbol() const noexcept { return (!isBlank()) && isSymbol_; }
-        inline bool isInstruction() const noexcept { return (!isBlank()) && (!isSymbol_); }
+        inline bool isInstruction() const noexcept { return (!isBlank()) && (!isSymbol_) && (!isDirective_); }
+        inline bool isDirective() const noexcept { return (!isBlank()) && isDirective_; }
 
         inline operator bool() const noexcept { return isBlank(); }
 
         inline const SymbolToken<IsaTraits>& getSymbol() const noexcept { return symbolToken_; }
         inline const InstructionToken<IsaTraits>& getInstruction() const noexcept { return instructionToken_; }
+        inline const DirectiveToken<IsaTraits>& getDirective() const noexcept { return directiveToken_; }
 
     };
 
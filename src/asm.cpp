@@ -32,6 +32,9 @@
 #include <genAsmLib/tokeniser.h>
 #include <genAsmLib/addressResolver.h>
 #include <genAsmLib/symbolTable.h>
+#include <genAsmLib/codedInstruction.h>
+#include <genAsmLib/disassembler.h>
+#include <genAsmLib/singlePassAssembler.h>
 #include <genAsmLib/fileReader.h>
 
 
@@ -82,10 +85,13 @@ namespace risc16
                 else
                     throw std::invalid_argument("Invalid register name");
             }
-            else if(easyParse::validateNumberString(str))
-                return easyParse::convertNumberString<RegisterCodeType>(str);
-            else
-                throw std::invalid_argument("Invalid register name");            
+
+            auto result = easyParse::parseNumber<RegisterCodeType>(str);
+
+            if((result.ec != std::errc{}) || (result.ptr != str.data() + str.size()))
+                throw std::invalid_argument("Invalid register name");
+
+            return result.value;
         }
 
         constexpr inline static ModifierCodeType resolveModifier(std::string_view) noexcept { return {}; }
@@ -102,6 +108,29 @@ namespace risc16
             return instrList[val];
         }
 
+        using Operand = gen_asm::OperandKind;
+
+        static constexpr std::array<gen_asm::OperandPattern, 8 + 5> operandPatterns = {{
+            { Operand::REGISTER, Operand::REGISTER, Operand::REGISTER },     // add
+            { Operand::REGISTER, Operand::REGISTER, Operand::IMMEDIATE },    // addi
+            { Operand::REGISTER, Operand::REGISTER, Operand::REGISTER },     // nand
+            { Operand::REGISTER, Operand::IMMEDIATE },                       // lui
+            { Operand::REGISTER, Operand::REGISTER, Operand::IMMEDIATE },    // lw
+            { Operand::REGISTER, Operand::REGISTER, Operand::IMMEDIATE },    // sw
+            { Operand::REGISTER, Operand::REGISTER, Operand::IMMEDIATE },    // beq
+            { Operand::REGISTER, Operand::REGISTER },                        // jalr
+            { Operand::REGISTER, Operand::IMMEDIATE },                       // movi
+            { Operand::REGISTER },                                           // push
+            { Operand::REGISTER },                                           // pop
+            { Operand::IMMEDIATE },                                          // call
+            { }                                                              // ret
+        }};
+
+        inline static const gen_asm::OperandPattern& getOperandPattern(OpCodeType op) noexcept
+        {
+            return operandPatterns[op];
+        }
+
         inline static OpCodeType resolveOpCode(std::string_view str)
         {
             for(std::size_t i = 0; i < instrList.size(); ++i)
@@ -111,28 +140,297 @@ namespace risc16
             throw std::invalid_argument("Invalid instruction");
         }
 
-        inline static std::size_t getSizeInBasic(BlockSizeType sz) noexcept
+        /// @brief Width in basic units of every block size code, 0 for codes naming no size.
+        static constexpr auto sizeWidthTable = []
         {
-            if(sz == gen_asm::literal::NO_DATA)
-                return 0;
-            else if(sz == gen_asm::literal::ASCII_DATA)
+            std::array<std::uint8_t, std::size_t(std::numeric_limits<BlockSizeType>::max()) + 1> table{};
+            table[gen_asm::literal::ASCII_DATA] = 1;
+            table[2] = 1;       // .word
+            table[3] = 2;       // .dword
+            table[4] = 4;       // .qword
+            return table;
+        }();
+
+        /// @brief Width of standard expansion of every op code, used when instructions are not relaxed.
+        static constexpr auto instrWidthTable = []
+        {
+            std::array<std::uint8_t, std::size_t(std::numeric_limits<OpCodeType>::max()) + 1> table{};
+            std::ranges::fill(table, 1);
+            table[8] = 2;       // movi : lui, addi
+            table[9] = 2;       // push : addi, sw
+            table[10] = 2;      // pop : lw, addi
+            table[11] = 3;      // call : lui, addi, jalr
+            return table;
+        }();
+
+        /// @brief Width of shortest expansion of every op code.
+        static constexpr auto minInstrWidthTable = []
+        {
+            std::array<std::uint8_t, std::size_t(std::numeric_limits<OpCodeType>::max()) + 1> table{};
+            std::ranges::fill(table, 1);
+            table[9] = 2;       // push : addi, sw
+            table[10] = 2;      // pop : lw, addi
+            table[11] = 2;      // call : addi, jalr
+            return table;
+        }();
+
+        constexpr inline static std::size_t getSizeInBasic(BlockSizeType sz) noexcept
+        {
+            return sizeWidthTable[sz];
+        }
+
+        constexpr inline static std::size_t getInstrWidthInBasic(OpCodeType op) noexcept
+        {
+            return instrWidthTable[op];
+        }
+
+        constexpr inline static std::size_t getMinInstrWidth(OpCodeType op) noexcept
+        {
+            return minInstrWidthTable[op];
+        }
+
+        /// @brief Check if value fits signed 7 bit immediate of addi, lw, sw, beq.
+        inline static bool fitsImmediate7(std::int64_t value) noexcept
+        {
+            return (value >= -64) && (value <= 63);
+        }
+
+        inline static bool isPcRelative(OpCodeType op) noexcept
+        {
+            return op == 6;     // beq
+        }
+
+        /**
+         * @brief Width of shortest expansion able to reach target from address.
+         * 
+         * - beq : 1 if displacement fits 7 bits, else 5 (beq over, beq around, lui, addi, jalr).
+         * - movi : 1 if value fits addi or only has upper 10 bits (lui), else 2.
+         * - call : 2 if target fits addi, else 3.
+         */
+        inline static std::size_t getRelaxedWidth(OpCodeType op, LargestType target, AddressType address) noexcept
+        {
+            auto value = static_cast<std::int16_t>(static_cast<WordType>(target));
+
+            switch (op)
+            {
+            case 6:
+                return fitsImmediate7(std::int64_t(static_cast<WordType>(target)) - address - 1) ? 1 : 5;
+            case 8:
+                return (fitsImmediate7(value) || ((value & 0x3F) == 0)) ? 1 : 2;
+            case 11:
+                return fitsImmediate7(value) ? 2 : 3;
+            default:
+                return getMinInstrWidth(op);
+            }
+        }
+
+    };
+
+    static_assert(gen_asm::WidthTableTraitModel<AssemblerTraits, AssemblerTraits>);
+
+    /// @brief Encoding of RISC-16 hardware instructions, 3 bit op code then operand fields.
+    namespace encoding
+    {
+        using WordType = AssemblerTraits::WordType;
+
+        constexpr std::size_t OPCODE_OFFSET = 13;
+
+        constexpr gen_asm::EncodingField REG_A = {10, 3, false};
+        constexpr gen_asm::EncodingField REG_B = {7, 3, false};
+        constexpr gen_asm::EncodingField REG_C = {0, 3, false};
+        constexpr gen_asm::EncodingField SIGNED_IMM_7 = {0, 7, true};
+        constexpr gen_asm::EncodingField IMM_10 = {0, 10, false};
+
+        /// @brief `opCode | rA | rB | 0000 | rC`.
+        template<WordType hwOpCode>
+        using RRR = gen_asm::EncodingTemplate<WordType, WordType(hwOpCode << OPCODE_OFFSET), REG_A, REG_B, REG_C>;
+
+        /// @brief `opCode | rA | rB | signed imm7`.
+        template<WordType hwOpCode>
+        using RRI = gen_asm::EncodingTemplate<WordType, WordType(hwOpCode << OPCODE_OFFSET), REG_A, REG_B, SIGNED_IMM_7>;
+
+        /// @brief `opCode | rA | imm10`.
+        template<WordType hwOpCode>
+        using RI = gen_asm::EncodingTemplate<WordType, WordType(hwOpCode << OPCODE_OFFSET), REG_A, IMM_10>;
+
+        /// @brief `opCode | rA | rB | 0000000`.
+        template<WordType hwOpCode>
+        using RR = gen_asm::EncodingTemplate<WordType, WordType(hwOpCode << OPCODE_OFFSET), REG_A, REG_B>;
+
+        /// @brief Encoding of op code (index in `AssemblerTraits::instrList`), hardware instructions only.
+        template<std::size_t op>
+        struct Encoding;
+
+        template<> struct Encoding<0> : RRR<0b000> {};      // add
+        template<> struct Encoding<1> : RRI<0b001> {};      // addi
+        template<> struct Encoding<2> : RRR<0b010> {};      // nand
+        template<> struct Encoding<3> : RI<0b011> {};       // lui
+        template<> struct Encoding<4> : RRI<0b101> {};      // lw
+        template<> struct Encoding<5> : RRI<0b100> {};      // sw
+        template<> struct Encoding<6> : RRI<0b110> {};      // beq
+        template<> struct Encoding<7> : RR<0b111> {};       // jalr
+
+        /// @brief Number of hardware op codes, pseudo instructions follow them in `AssemblerTraits::instrList`.
+        constexpr std::size_t HARDWARE_OPCODE_COUNT = 8;
+
+        constexpr auto encoders = gen_asm::makeEncoderTable<WordType, Encoding, HARDWARE_OPCODE_COUNT>();
+
+        /**
+         * @brief Encode hardware instruction from operand values in operand order.
+         * 
+         * @throw `std::invalid_argument` : Pseudo instruction or wrong number of operands.
+         * @throw `std::out_of_range` : Operand does not fit its field.
+         */
+        inline WordType encode(AssemblerTraits::OpCodeType op, std::span<const std::uint64_t> operands)
+        {
+            if(op >= HARDWARE_OPCODE_COUNT)
+                throw std::invalid_argument("Pseudo instruction has no single word encoding");
+
+            return encoders[op](operands);
+        }
+    }
+
+    /**
+     * @brief Traits encoding RISC-16 instructions, pseudo instructions in their standard expansion.
+     * 
+     * - movi rA, imm : lui rA, imm >> 6; addi rA, rA, imm & 0x3F
+     * - push rA : addi sp, sp, -1; sw rA, sp, 0
+     * - pop rA : lw rA, sp, 0; addi sp, sp, 1
+     * - call target : lui ra, target >> 6; addi ra, ra, target & 0x3F; jalr ra, ra
+     * - ret : jalr r0, ra
+     * 
+     * Relaxed widths of `getRelaxedWidth` are encoded by `encodeRelaxedInstruction`.
+     */
+    struct EncoderTraits : public AssemblerTraits
+    {
+        static constexpr std::uint64_t SP = 2;
+        static constexpr std::uint64_t RA = 3;
+
+        /// @brief Register holding target of far branch, clobbered by it.
+        static constexpr std::uint64_t FAR_BRANCH_REG = 7;
+
+        /// @throw see `encoding::encode`.
+        inline static std::size_t encodeInstruction(
+            OpCodeType op, 
+            std::span<const std::uint64_t> operands, 
+            std::span<WordType> out
+        )
+        {
+            using Operands2 = std::array<std::uint64_t, 2>;
+            using Operands3 = std::array<std::uint64_t, 3>;
+
+            switch (op)
+            {
+            case 8:
+                out[0] = encoding::encode(3, Operands2{operands[0], (operands[1] >> 6) & 0x3FF});
+                out[1] = encoding::encode(1, Operands3{operands[0], operands[0], operands[1] & 0x3F});
+                return 2;
+            case 9:
+                out[0] = encoding::encode(1, Operands3{SP, SP, std::uint64_t(-1)});
+                out[1] = encoding::encode(5, Operands3{operands[0], SP, 0});
+                return 2;
+            case 10:
+                out[0] = encoding::encode(4, Operands3{operands[0], SP, 0});
+                out[1] = encoding::encode(1, Operands3{SP, SP, 1});
+                return 2;
+            case 11:
+                out[0] = encoding::encode(3, Operands2{RA, (operands[0] >> 6) & 0x3FF});
+                out[1] = encoding::encode(1, Operands3{RA, RA, operands[0] & 0x3F});
+                out[2] = encoding::encode(7, Operands2{RA, RA});
+                return 3;
+            case 12:
+                out[0] = encoding::encode(7, Operands2{0, RA});
                 return 1;
-            else if(sz == 2)
+            default:
+                out[0] = encoding::encode(op, operands);
                 return 1;
-            else if(sz == 3)
-                return 2;
-            else if(sz == 4)
-                return 4;
-            else 
-                return 0;
+            }
         }
 
-        inline static std::size_t getInstrWidthInBasic(OpCodeType op) noexcept
+        /**
+         * @brief Encode instruction at address in width of out, chosen by `getRelaxedWidth`.
+         * 
+         * - movi rA, imm (1) : addi rA, r0, imm if it fits, else lui rA, imm >> 6
+         * - call target (2) : addi ra, r0, target; jalr ra, ra
+         * - beq rA, rB, disp (5) : beq rA, rB, 1; beq r0, r0, 3; lui r7, target >> 6; addi r7, r7, target & 0x3F; jalr r0, r7
+         * 
+         * Standard widths are encoded by `encodeInstruction`.
+         * 
+         * @throw `std::invalid_argument` : No encoding of op code in width.
+         * @throw see `encoding::encode`.
+         */
+        inline static std::size_t encodeRelaxedInstruction(
+            OpCodeType op, 
+            std::span<const std::uint64_t> operands, 
+            AddressType address,
+            std::span<WordType> out
+        )
         {
-            return 1;
+            using Operands2 = std::array<std::uint64_t, 2>;
+            using Operands3 = std::array<std::uint64_t, 3>;
+
+            if(out.size() == getInstrWidthInBasic(op))
+                return encodeInstruction(op, operands, out);
+
+            // Immediates of addi forms, sign extended from word.
+            auto signedImmediate = [](std::uint64_t value) 
+            {
+                return static_cast<std::uint64_t>(static_cast<std::int16_t>(value));
+            };
+
+            switch ((op << 4) | out.size())
+            {
+            case (8 << 4) | 1:
+                if(fitsImmediate7(static_cast<std::int16_t>(operands[1])))
+                    out[0] = encoding::encode(1, Operands3{operands[0], 0, signedImmediate(operands[1])});
+                else
+                    out[0] = encoding::encode(3, Operands2{operands[0], (operands[1] >> 6) & 0x3FF});
+                return 1;
+            case (11 << 4) | 2:
+                out[0] = encoding::encode(1, Operands3{RA, 0, signedImmediate(operands[0])});
+                out[1] = encoding::encode(7, Operands2{RA, RA});
+                return 2;
+            case (6 << 4) | 5:
+            {
+                std::uint64_t target = static_cast<WordType>(address + 1 + operands[2]);
+                out[0] = encoding::encode(6, Operands3{operands[0], operands[1], 1});
+                out[1] = encoding::encode(6, Operands3{0, 0, 3});
+                out[2] = encoding::encode(3, Operands2{FAR_BRANCH_REG, (target >> 6) & 0x3FF});
+                out[3] = encoding::encode(1, Operands3{FAR_BRANCH_REG, FAR_BRANCH_REG, target & 0x3F});
+                out[4] = encoding::encode(7, Operands2{0, FAR_BRANCH_REG});
+                return 5;
+            }
+            default:
+                throw std::invalid_argument("No encoding of instruction in width");
+            }
         }
+    };
 
+    static_assert(gen_asm::EncoderTraitModel<EncoderTraits, AssemblerTraits>);
+
+    /// @brief Traits decoding RISC-16 words by their 3 bit op code, through the field layouts of `encoding`.
+    struct DisassemblerTraits : public AssemblerTraits
+    {
+        static constexpr std::size_t decoderShift = encoding::OPCODE_OFFSET;
+
+        static constexpr auto decoderTable = gen_asm::makeDecoderTable<
+            WordType, encoding::Encoding, encoding::HARDWARE_OPCODE_COUNT, encoding::OPCODE_OFFSET, 3
+        >();
     };
+
+    /**
+     * @brief Write stats of symbol table as one JSON line, in builds with `RISC_16_ASM_SYMBOL_TIMING` 
+     * (which defines GEN_ASM_SYMBOL_TIMING), no op otherwise.
+     * 
+     * For the assembler driver to call once every unit is resolved, this file has no `main` yet.
+     */
+    template<class Table>
+    inline void writeSymbolStats([[maybe_unused]] const Table& table, [[maybe_unused]] std::ostream& out)
+    {
+#ifdef GEN_ASM_SYMBOL_TIMING
+        out << gen_asm::toJson(table.getStats()) << '\n';
+#endif
+    }
 }
 
 
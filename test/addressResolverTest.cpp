@@ -0,0 +1,236 @@
+/**
+ * @file addressResolverTest.cpp 
+ * @author Harith Manoj (harithpub@gmail.com)
+ * @brief Tests of section offsets, reserved data, alignment and layout.
+ * @date 17 October 2026
+ * 
+ * @copyright Copyright (C) 2024
+ * 
+ * 
+ *                      GNU GENERAL PUBLIC LICENSE 
+ *                        Version 3, 29 June 2007 
+ * 
+ * This program is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published by 
+ * the Free Software Foundation, either version 3 of the License, or 
+ * (at your option) any later version. 
+ *  
+ * This program is distributed in the hope that it will be useful, 
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details. 
+ *  
+ * You should have received a copy of the GNU General Public License 
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../src/asm.cpp"
+
+#include "testCheck.h"
+
+using Traits = risc16::AssemblerTraits;
+using Resolver = gen_asm::AddressResolver<Traits, Traits>;
+using Table = gen_asm::SymbolTable<Traits, Traits, Resolver>;
+using Tokenizer = gen_asm::Tokenizer<Traits, Traits>;
+
+/// @brief Tokenize line into resolver and table of unit 0.
+void assemble(Tokenizer& tokenizer, Resolver& resolver, Table& table, std::string_view line)
+{
+    tokenizer.tokenize(line);
+
+    if(tokenizer.isSymbol())
+        table.addSymbol(0, tokenizer.getSymbol());
+    else if(tokenizer.isInstruction())
+        resolver.updateOffsets(tokenizer.getInstruction());
+    else if(tokenizer.isDirective())
+        resolver.updateOffsets(tokenizer.getDirective());
+}
+
+int main()
+{
+    Tokenizer tokenizer;
+
+    // Data symbols keep only given initial values, const symbols every element.
+    tokenizer.tokenize("buf: .data .word [60000]");
+    TEST_CHECK(tokenizer.getSymbol().init_value.empty() && (tokenizer.getSymbol().elementCount == 60000));
+    tokenizer.tokenize("tbl: .data .word [4] 1, 2");
+    TEST_CHECK((tokenizer.getSymbol().init_value.size() == 2) && (tokenizer.getSymbol().elementCount == 4));
+    tokenizer.tokenize("k: .const .word [3] 7");
+    TEST_CHECK((tokenizer.getSymbol().init_value.size() == 3) && (tokenizer.getSymbol().elementCount == 3));
+    tokenizer.tokenize("s: .data .ascii \"ab\"");
+    TEST_CHECK(tokenizer.getSymbol().elementCount == 3);
+
+    {
+        Resolver resolver;
+        Table table(resolver);
+
+        assemble(tokenizer, resolver, table, "buf: .data .word [60000]");
+        assemble(tokenizer, resolver, table, "tbl: .data .dword [4] 1, 2");
+        TEST_CHECK(resolver.getDataAddressOffset() == 60008);
+        TEST_CHECK(table.resolveSymbol(0, {"buf", 59999, 0}) == 59999);
+        TEST_CHECK(table.resolveSymbol(0, {"tbl", 3, 1}) == 60007);
+        TEST_CHECK_THROWS((void)table.resolveSymbol(0, {"buf", 60000, 0}), std::out_of_range);
+
+        // Element counts overflowing address space are rejected without allocating.
+        TEST_CHECK_THROWS(assemble(tokenizer, resolver, table, "big: .data .qword [0x4000]"), std::out_of_range);
+        TEST_CHECK_THROWS(assemble(tokenizer, resolver, table, "huge: .data .qword [0xFFFFFFFFFFFFFFFF]"), std::out_of_range);
+    }
+
+    // Data symbol without elements names buffer reserved after it.
+    {
+        Resolver resolver;
+        Table table(resolver);
+
+        assemble(tokenizer, resolver, table, ".section .bss");
+        assemble(tokenizer, resolver, table, "stack: .data .word [0]");
+        assemble(tokenizer, resolver, table, ".zero 256");
+        assemble(tokenizer, resolver, table, "top: .data .word [0]");
+        resolver.layoutSections();
+
+        auto base = resolver.getSectionBase(resolver.findSection(gen_asm::literal::BSS_SECTION));
+        TEST_CHECK(table.resolveSymbol(0, {"stack", 0, 0}) == base);
+        TEST_CHECK(table.resolveSymbol(0, {"top", 0, 0}) == base + 256u);
+        TEST_CHECK_THROWS((void)table.resolveSymbol(0, {"stack", 1, 0}), std::out_of_range);
+    }
+
+    // Alignments are powers of two.
+    {
+        Resolver resolver;
+
+        TEST_CHECK_THROWS(resolver.align(0), std::invalid_argument);
+        TEST_CHECK_THROWS(resolver.align(6), std::invalid_argument);
+        TEST_CHECK_THROWS(resolver.align(std::size_t(1) << 16), std::out_of_range);
+        TEST_CHECK_THROWS((void)resolver.addSection(".odd", gen_asm::SectionKind::CODE, 3), std::invalid_argument);
+        TEST_CHECK_THROWS((void)resolver.addSection(".none", gen_asm::SectionKind::CODE, 0), std::invalid_argument);
+        TEST_CHECK_THROWS(tokenizer.tokenize(".align 12"), std::invalid_argument);
+        TEST_CHECK_THROWS(tokenizer.tokenize(".align 0"), std::invalid_argument);
+
+        // Padding and merged alignment of section.
+        tokenizer.tokenize("add %r1, %r1, %r1");
+        resolver.updateOffsets(tokenizer.getInstruction());
+        resolver.align(4);
+        TEST_CHECK(resolver.getCodeAddressOffset() == 4);
+        resolver.align(2);
+        TEST_CHECK(resolver.getCodeAddressOffset() == 4);
+        TEST_CHECK(resolver.getSection(resolver.getCodeSection()).alignment == 4);
+
+        auto fills = resolver.getCodeFills();
+        TEST_CHECK((fills.size() == 1) && (fills[0].offset == 1) && (fills[0].count == 3) && (fills[0].value == 0));
+    }
+
+    // Sections laid out in order of declaration, aligned, around pinned sections.
+    {
+        Resolver resolver;
+        Table table(resolver);
+
+        auto fast = resolver.addSection(".fast", gen_asm::SectionKind::CODE, 8);
+        resolver.setSectionBase(gen_asm::literal::VECTORS_SECTION, 4);
+
+        for(auto line : {
+            "add %r1, %r1, %r1", "add %r1, %r1, %r1", "add %r1, %r1, %r1", 
+            ".section .vectors", "beq %r0, %r0, $0", "beq %r0, %r0, $0",
+            ".section .fast", "handler:", "movi %r1, $0x1234", 
+            "buf: .data .word [3]", ".section .rodata", "tbl: .data .word [2] 1, 2", 
+            ".section .bss", "big: .data .word [100]"
+        })
+            assemble(tokenizer, resolver, table, line);
+
+        resolver.layoutSections();
+
+        // .text [0, 3), pinned .vectors [4, 6), .fast aligned past them at 8.
+        auto vectors = resolver.findSection(gen_asm::literal::VECTORS_SECTION);
+        TEST_CHECK(resolver.getSectionBase(0) == 0);
+        TEST_CHECK(resolver.getSectionBase(vectors) == 4);
+        TEST_CHECK(resolver.getSectionBase(fast) == 8);
+        TEST_CHECK(table.resolveSymbol(0, {"handler"}) == 8);
+        TEST_CHECK(resolver.getCodeSize() == 10);
+
+        // .data [0, 3), .rodata [3, 5), .bss [5, 105), only .bss is left out of image.
+        TEST_CHECK(table.resolveSymbol(0, {"tbl", 1}) == 4);
+        TEST_CHECK(table.resolveSymbol(0, {"big"}) == 5);
+        TEST_CHECK(resolver.getDataSize() == 105);
+        TEST_CHECK(resolver.getImageSize() == 3 + 2 + 2 + 3 + 2);
+
+        const auto& map = resolver.getCodeMap();
+        std::vector<std::string> names;
+        for(const auto& [start, region] : map)
+            names.push_back(region.name);
+        TEST_CHECK((names == std::vector<std::string>{".text", ".vectors", ".fast"}));
+        TEST_CHECK(map.freeSpace().front().start == 3);
+
+        // Laying out again after growth moves unpinned sections only.
+        assemble(tokenizer, resolver, table, ".section .text");
+        for(int i = 0; i < 3; ++i)
+            assemble(tokenizer, resolver, table, "add %r1, %r1, %r1");
+
+        resolver.layoutSections();
+        TEST_CHECK(resolver.getSectionBase(0) == 6);
+        TEST_CHECK(resolver.getSectionBase(vectors) == 4);
+        TEST_CHECK(resolver.getSectionBase(fast) == 16);
+        TEST_CHECK(table.resolveSymbol(0, {"handler"}) == 16);
+
+        TEST_CHECK_THROWS((void)resolver.addSection(".fast", gen_asm::SectionKind::DATA), std::domain_error);
+        TEST_CHECK_THROWS(resolver.selectSection(".missing"), std::invalid_argument);
+        TEST_CHECK_THROWS(resolver.setSectionBase(".missing", 0), std::invalid_argument);
+    }
+
+    // Pinned sections and origins may not overlap or wrap.
+    {
+        Resolver resolver;
+        Table table(resolver);
+
+        assemble(tokenizer, resolver, table, "add %r1, %r1, %r1");
+        assemble(tokenizer, resolver, table, ".org 0x100");
+        assemble(tokenizer, resolver, table, "at100:");
+        assemble(tokenizer, resolver, table, "add %r1, %r1, %r1");
+        assemble(tokenizer, resolver, table, "add %r1, %r1, %r1");
+
+        TEST_CHECK(resolver.getSection(resolver.getCodeSection()).name == ".text@256");
+        TEST_CHECK_THROWS(assemble(tokenizer, resolver, table, ".org 0x100"), std::domain_error);
+        TEST_CHECK_THROWS(resolver.org(std::size_t(1) << 16), std::out_of_range);
+
+        resolver.layoutSections();
+        TEST_CHECK(table.resolveSymbol(0, {"at100"}) == 0x100);
+        TEST_CHECK(resolver.getCodeSize() == 0x102);
+
+        // Origin inside region of previous origin.
+        assemble(tokenizer, resolver, table, ".org 0x101");
+        assemble(tokenizer, resolver, table, "add %r1, %r1, %r1");
+        TEST_CHECK_THROWS(resolver.layoutSections(), std::domain_error);
+    }
+
+    {
+        Resolver resolver;
+        Table table(resolver);
+
+        resolver.setSectionBase(gen_asm::literal::TEXT_SECTION, 0xFFFF);
+        assemble(tokenizer, resolver, table, "add %r1, %r1, %r1");
+        assemble(tokenizer, resolver, table, "add %r1, %r1, %r1");
+        TEST_CHECK_THROWS(resolver.layoutSections(), std::out_of_range);
+    }
+
+    // Unpinned sections fill gaps between pinned sections large enough, and are pushed past the others.
+    {
+        Resolver resolver;
+        Table table(resolver);
+
+        resolver.setSectionBase(gen_asm::literal::VECTORS_SECTION, 2);
+        assemble(tokenizer, resolver, table, ".section .vectors");
+        assemble(tokenizer, resolver, table, "add %r1, %r1, %r1");
+        assemble(tokenizer, resolver, table, ".section .text");
+        for(int i = 0; i < 3; ++i)
+            assemble(tokenizer, resolver, table, "add %r1, %r1, %r1");
+
+        resolver.layoutSections();
+        TEST_CHECK(resolver.getSectionBase(0) == 3);
+    }
+
+    return test::result();
+}
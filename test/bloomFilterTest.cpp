@@ -0,0 +1,93 @@
+/**
+ * @file bloomFilterTest.cpp 
+ * @author Harith Manoj (harithpub@gmail.com)
+ * @brief Tests of Bloom filter of symbol names.
+ * @date 17 October 2026
+ * 
+ * @copyright Copyright (C) 2024
+ * 
+ * 
+ *                      GNU GENERAL PUBLIC LICENSE 
+ *                        Version 3, 29 June 2007 
+ * 
+ * This program is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published by 
+ * the Free Software Foundation, either version 3 of the License, or 
+ * (at your option) any later version. 
+ *  
+ * This program is distributed in the hope that it will be useful, 
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details. 
+ *  
+ * You should have received a copy of the GNU General Public License 
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+#include <string>
+#include <vector>
+
+#include <genAsmLib/bloomFilter.h>
+
+#include "testCheck.h"
+
+/// @brief Distinct symbol like names.
+std::vector<std::string> makeNames(std::string_view prefix, std::size_t count)
+{
+    std::vector<std::string> names;
+    names.reserve(count);
+
+    for(std::size_t i = 0; i < count; ++i)
+        names.push_back(std::string(prefix) + std::to_string(i));
+
+    return names;
+}
+
+int main()
+{
+    using gen_asm::BloomFilter;
+
+    // Size rounded up to power of 2, at least one word.
+    TEST_CHECK(BloomFilter(1).sizeInBytes() == 8);
+    TEST_CHECK(BloomFilter(100).sizeInBytes() == 16);
+    TEST_CHECK(BloomFilter().sizeInBytes() == gen_asm::literal::UNIT_BLOOM_BITS / 8);
+
+    auto present = makeNames("label_", 200);
+    auto absent = makeNames("other_", 10000);
+
+    // Empty filter contains nothing.
+    BloomFilter filter;
+    for(const auto& name : present)
+        TEST_CHECK(!filter.mayContain(name));
+
+    for(const auto& name : present)
+        filter.add(name);
+
+    // No false negatives, by name or by precomputed hash.
+    for(const auto& name : present)
+    {
+        TEST_CHECK(filter.mayContain(name));
+        TEST_CHECK(filter.mayContain(BloomFilter::hash(name)));
+    }
+
+    // Smallest filter saturates but still has no false negatives.
+    BloomFilter tiny(64);
+    for(const auto& name : present)
+        tiny.add(BloomFilter::hash(name));
+    for(const auto& name : present)
+        TEST_CHECK(tiny.mayContain(name));
+
+    // False positives stay rare at unit filter load (about 1% expected).
+    std::size_t falsePositives = 0;
+    for(const auto& name : absent)
+        falsePositives += filter.mayContain(name);
+    TEST_CHECK(falsePositives < absent.size() / 20);
+
+    filter.clear();
+    for(const auto& name : present)
+        TEST_CHECK(!filter.mayContain(name));
+
+    return test::result();
+}
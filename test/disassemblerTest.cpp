@@ -0,0 +1,150 @@
+/**
+ * @file disassemblerTest.cpp 
+ * @author Harith Manoj (harithpub@gmail.com)
+ * @brief Tests of RISC-16 decode table, symbol naming and listings.
+ * @date 17 October 2026
+ * 
+ * @copyright Copyright (C) 2024
+ * 
+ * 
+ *                      GNU GENERAL PUBLIC LICENSE 
+ *                        Version 3, 29 June 2007 
+ * 
+ * This program is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published by 
+ * the Free Software Foundation, either version 3 of the License, or 
+ * (at your option) any later version. 
+ *  
+ * This program is distributed in the hope that it will be useful, 
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details. 
+ *  
+ * You should have received a copy of the GNU General Public License 
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../src/asm.cpp"
+
+#include "testCheck.h"
+
+using Traits = risc16::AssemblerTraits;
+using Disassembler = gen_asm::Disassembler<Traits, risc16::DisassemblerTraits>;
+using Resolver = gen_asm::AddressResolver<Traits, Traits>;
+using Table = gen_asm::SymbolTable<Traits, Traits, Resolver>;
+
+int main()
+{
+    // Decode table maps 3 bit hardware op codes to op codes of instruction list.
+    constexpr std::array<std::size_t, 8> opCodeOfBits = {0, 1, 2, 3, 5, 4, 6, 7};
+    const auto& table = risc16::DisassemblerTraits::decoderTable;
+    TEST_CHECK(table.size() == 8);
+    for(std::size_t bits = 0; bits < table.size(); ++bits)
+        TEST_CHECK((table[bits].opCode == opCodeOfBits[bits]) && (table[bits].decode != nullptr));
+
+    Disassembler disassembler;
+    gen_asm::Tokenizer<Traits, Traits> tokenizer;
+
+    // Text of every word tokenizes back to the same op code and operands.
+    std::size_t mismatches = 0;
+    for(std::uint32_t word = 0; word <= 0xFFFF; ++word)
+    {
+        auto decoded = disassembler.decode(static_cast<std::uint16_t>(word));
+        tokenizer.tokenize(disassembler.format(decoded, 0x100));
+
+        const auto& token = tokenizer.getInstruction();
+        bool isEqual = tokenizer.isInstruction() && (token.opCode == decoded.opCode) 
+            && (token.operands.count == decoded.operandCount) && token.operands.isResolved();
+
+        for(std::size_t i = 0; isEqual && (i < decoded.operandCount); ++i)
+            isEqual = (token.operands.values[i] == decoded.operands[i]);
+
+        mismatches += !isEqual;
+    }
+    TEST_CHECK(mismatches == 0);
+
+    TEST_CHECK(disassembler.format(disassembler.decode(0b110'001'010'1111101), 0) == "beq %r1, %r2, $-3");
+    TEST_CHECK(disassembler.format(disassembler.decode(0b011'011'1111111111), 0) == "lui %r3, $1023");
+
+    // Branch targets and addresses are named after jump symbols of table.
+    Resolver resolver;
+    Table symbols(resolver);
+
+    const std::vector<std::string_view> source = {
+        "start:", 
+        "add %r1, %r1, %r2",
+        "loop:",
+        "again:",
+        "addi %r1, %r1, $-1",
+        "beq %r1, %r0, loop",
+        "beq %r0, %r0, start",
+        "beq %r0, %r0, $5"
+    };
+
+    for(auto line : source)
+    {
+        tokenizer.tokenize(line);
+        if(tokenizer.isSymbol())
+            symbols.addSymbol(0, tokenizer.getSymbol());
+        else
+            resolver.updateOffsets(tokenizer.getInstruction());
+    }
+
+    symbols.setBaseAddress(0x40, 0);
+    disassembler.loadSymbols(symbols);
+
+    const std::vector<std::uint16_t> words = {
+        risc16::encoding::encode(0, std::array<std::uint64_t, 3>{1, 1, 2}),
+        risc16::encoding::encode(1, std::array<std::uint64_t, 3>{1, 1, std::uint64_t(-1)}),
+        risc16::encoding::encode(6, std::array<std::uint64_t, 3>{1, 0, std::uint64_t(-2)}),
+        risc16::encoding::encode(6, std::array<std::uint64_t, 3>{0, 0, std::uint64_t(-4)}),
+        risc16::encoding::encode(6, std::array<std::uint64_t, 3>{0, 0, 5})
+    };
+
+    auto listing = disassembler.disassemble(words, 0x40);
+    TEST_CHECK(listing == 
+        "start:\n"
+        "add %r1, %r1, %r2\n"
+        "loop:\n"
+        "addi %r1, %r1, $-1\n"
+        "beq %r1, %r0, loop\n"
+        "beq %r0, %r0, start\n"
+        "beq %r0, %r0, $5\n"
+    );
+
+    // Listing assembles back to the same words against the same symbols.
+    std::size_t address = 0x40;
+    std::size_t index = 0;
+    tokenizer.resetLocalLabels();
+    for(auto line : easyParse::SplitView(listing, "\n"))
+    {
+        tokenizer.tokenize(line, false);
+        if(!tokenizer.isInstruction())
+            continue;
+
+        auto instr = tokenizer.getInstruction();
+        symbols.resolveOperands(0, instr);
+
+        if(!instr.symbolArgs.empty())
+            instr.operands.values[2] -= address + 1;
+
+        TEST_CHECK(risc16::encoding::encode(instr.opCode, instr.operands.view()) == words.at(index));
+        ++address;
+        ++index;
+    }
+    TEST_CHECK(index == words.size());
+
+    // Names are cleared with symbols.
+    disassembler.clearSymbols();
+    TEST_CHECK(disassembler.format(disassembler.decode(words[2]), 0x42) == "beq %r1, %r0, $-2");
+
+    return test::result();
+}
@@ -0,0 +1,151 @@
+/**
+ * @file encodingTest.cpp 
+ * @author Harith Manoj (harithpub@gmail.com)
+ * @brief Round trip tests of RISC-16 encoding through disassembler.
+ * @date 17 October 2026
+ * 
+ * @copyright Copyright (C) 2024
+ * 
+ * 
+ *                      GNU GENERAL PUBLIC LICENSE 
+ *                        Version 3, 29 June 2007 
+ * 
+ * This program is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published by 
+ * the Free Software Foundation, either version 3 of the License, or 
+ * (at your option) any later version. 
+ *  
+ * This program is distributed in the hope that it will be useful, 
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details. 
+ *  
+ * You should have received a copy of the GNU General Public License 
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+#include "../src/asm.cpp"
+
+#include "testCheck.h"
+
+using Traits = risc16::AssemblerTraits;
+using Disassembler = gen_asm::Disassembler<Traits, risc16::DisassemblerTraits>;
+
+/// @brief Range of values of every operand field of op code, in operand order.
+struct FieldRange
+{
+    std::int64_t min;
+    std::int64_t max;
+};
+
+constexpr FieldRange REGISTER = {0, 7};
+constexpr FieldRange SIGNED_IMM_7 = {-64, 63};
+constexpr FieldRange IMM_10 = {0, 1023};
+
+/// @brief Operand ranges of hardware op codes, `count` operands used.
+struct OpRanges
+{
+    std::size_t count;
+    std::array<FieldRange, 3> fields;
+};
+
+constexpr std::array<OpRanges, risc16::encoding::HARDWARE_OPCODE_COUNT> ranges = {{
+    {3, {REGISTER, REGISTER, REGISTER}},        // add
+    {3, {REGISTER, REGISTER, SIGNED_IMM_7}},    // addi
+    {3, {REGISTER, REGISTER, REGISTER}},        // nand
+    {2, {REGISTER, IMM_10}},                    // lui
+    {3, {REGISTER, REGISTER, SIGNED_IMM_7}},    // lw
+    {3, {REGISTER, REGISTER, SIGNED_IMM_7}},    // sw
+    {3, {REGISTER, REGISTER, SIGNED_IMM_7}},    // beq
+    {2, {REGISTER, REGISTER}}                   // jalr
+}};
+
+int main()
+{
+    Disassembler disassembler;
+
+    // Every operand combination of every hardware op code encodes and decodes back.
+    for(std::size_t op = 0; op < risc16::encoding::HARDWARE_OPCODE_COUNT; ++op)
+    {
+        const auto& range = ranges[op];
+        std::array<std::int64_t, 3> value = {range.fields[0].min, range.fields[1].min, range.fields[2].min};
+        std::size_t failures = 0;
+
+        while(true)
+        {
+            std::array<std::uint64_t, 3> operands = {
+                static_cast<std::uint64_t>(value[0]), static_cast<std::uint64_t>(value[1]), static_cast<std::uint64_t>(value[2])
+            };
+            auto used = std::span<const std::uint64_t>(operands.data(), range.count);
+
+            auto word = risc16::encoding::encode(static_cast<Traits::OpCodeType>(op), used);
+            auto decoded = disassembler.decode(word);
+            auto token = disassembler.toToken(decoded);
+
+            bool isEqual = (decoded.opCode == op) && (decoded.operandCount == range.count) && token.operands.isResolved();
+            for(std::size_t i = 0; i < range.count; ++i)
+                isEqual = isEqual && (decoded.operands[i] == operands[i]) && (token.operands.values[i] == operands[i]);
+
+            failures += !isEqual;
+
+            std::size_t i = 0;
+            for(; i < range.count; ++i)
+            {
+                if(value[i] < range.fields[i].max)
+                {
+                    ++value[i];
+                    break;
+                }
+                value[i] = range.fields[i].min;
+            }
+
+            if(i == range.count)
+                break;
+        }
+
+        TEST_CHECK(failures == 0);
+    }
+
+    // Every word decodes, and encodes back to itself with bits outside fields clear.
+    std::size_t mismatches = 0;
+    for(std::uint32_t word = 0; word <= 0xFFFF; ++word)
+    {
+        auto decoded = disassembler.decode(static_cast<std::uint16_t>(word));
+        auto encoded = risc16::encoding::encode(decoded.opCode, std::span<const std::uint64_t>(decoded.operands.data(), decoded.operandCount));
+
+        std::uint16_t unused = 0;
+        if((decoded.opCode == 0) || (decoded.opCode == 2))
+            unused = 0b1111000;
+        else if(decoded.opCode == 7)
+            unused = 0b1111111;
+
+        mismatches += (encoded != (word & ~unused));
+    }
+    TEST_CHECK(mismatches == 0);
+
+    // Negative immediates are two's complement in 7 bits, sign extended by decoder.
+    auto word = risc16::encoding::encode(1, std::array<std::uint64_t, 3>{1, 2, std::uint64_t(-1)});
+    TEST_CHECK(word == 0b001'001'010'1111111);
+    TEST_CHECK(disassembler.decode(word).operands[2] == std::uint64_t(-1));
+    TEST_CHECK(disassembler.decode(risc16::encoding::encode(6, std::array<std::uint64_t, 3>{0, 0, std::uint64_t(-64)})).operands[2] == std::uint64_t(-64));
+
+    // Values outside fields.
+    using Operands = std::array<std::uint64_t, 3>;
+    TEST_CHECK_THROWS((void)risc16::encoding::encode(1, Operands{1, 1, 64}), std::out_of_range);
+    TEST_CHECK_THROWS((void)risc16::encoding::encode(4, Operands{1, 1, std::uint64_t(-65)}), std::out_of_range);
+    TEST_CHECK_THROWS((void)risc16::encoding::encode(0, Operands{8, 1, 1}), std::out_of_range);
+    TEST_CHECK_THROWS((void)risc16::encoding::encode(3, std::array<std::uint64_t, 2>{1, 1024}), std::out_of_range);
+    TEST_CHECK_THROWS((void)risc16::encoding::encode(3, std::array<std::uint64_t, 2>{1, std::uint64_t(-1)}), std::out_of_range);
+
+    // Wrong operand count and pseudo instructions.
+    TEST_CHECK_THROWS((void)risc16::encoding::encode(7, Operands{1, 1, 1}), std::invalid_argument);
+    TEST_CHECK_THROWS((void)risc16::encoding::encode(8, std::array<std::uint64_t, 2>{1, 1}), std::invalid_argument);
+
+    return test::result();
+}
@@ -0,0 +1,146 @@
+/**
+ * @file expressionTest.cpp 
+ * @author Harith Manoj (harithpub@gmail.com)
+ * @brief Tests of expression compiling, folding and evaluation.
+ * @date 17 October 2026
+ * 
+ * @copyright Copyright (C) 2024
+ * 
+ * 
+ *                      GNU GENERAL PUBLIC LICENSE 
+ *                        Version 3, 29 June 2007 
+ * 
+ * This program is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published by 
+ * the Free Software Foundation, either version 3 of the License, or 
+ * (at your option) any later version. 
+ *  
+ * This program is distributed in the hope that it will be useful, 
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details. 
+ *  
+ * You should have received a copy of the GNU General Public License 
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+
+#include <genAsmLib/expression.h>
+
+#include "testCheck.h"
+
+/// @brief Value of expression without symbol references.
+std::uint64_t constantValue(std::string_view text)
+{
+    auto expression = gen_asm::compileExpression<std::uint64_t>(text);
+    return expression.evaluate([](const auto&) -> std::uint64_t { return 0; });
+}
+
+/// @brief Value of expression, symbol `a` is 10, `b` is 3, `t[i][j]` is 100 + 10 * i + j.
+std::uint64_t symbolValue(std::string_view text)
+{
+    auto expression = gen_asm::compileExpression<std::uint64_t>(text);
+    return expression.evaluate(
+        [](const std::tuple<std::string, std::size_t, std::size_t>& symbol) -> std::uint64_t
+        {
+            const auto& [name, primary, secondary] = symbol;
+            if(name == "a")
+                return 10;
+            if(name == "b")
+                return 3;
+            return 100 + 10 * primary + secondary;
+        }
+    );
+}
+
+/// @brief Signed value of expression without symbol references.
+std::int64_t signedValue(std::string_view text)
+{
+    return static_cast<std::int64_t>(constantValue(text));
+}
+
+int main()
+{
+    // Plain and escaped character literals.
+    TEST_CHECK(constantValue("'a'") == 'a');
+    TEST_CHECK(constantValue("'a' + 1") == 'b');
+    TEST_CHECK(constantValue(R"('\n')") == '\n');
+    TEST_CHECK(constantValue(R"('\'')") == '\'');
+
+    // Escaped backslash ends at following quote, not at one after it.
+    TEST_CHECK(constantValue(R"('\\')") == '\\');
+    TEST_CHECK(constantValue(R"('\\'+1)") == '\\' + 1);
+    TEST_CHECK(constantValue(R"('\\' | '\'')") == ('\\' | '\''));
+
+    // Unterminated and empty literals.
+    TEST_CHECK_THROWS(constantValue("'a"), std::invalid_argument);
+    TEST_CHECK_THROWS(constantValue(R"('\')"), std::invalid_argument);
+    TEST_CHECK_THROWS(constantValue("''"), std::invalid_argument);
+
+    // Precedence and associativity.
+    TEST_CHECK(constantValue("2 + 3 * 4") == 14);
+    TEST_CHECK(constantValue("(2 + 3) * 4") == 20);
+    TEST_CHECK(constantValue("10 - 4 - 3") == 3);
+    TEST_CHECK(constantValue("64 / 4 / 2") == 8);
+    TEST_CHECK(constantValue("1 << 2 + 1") == 8);
+    TEST_CHECK(constantValue("6 & 3 | 8") == 10);
+    TEST_CHECK(constantValue("1 | 6 ^ 3") == 5);
+    TEST_CHECK(constantValue("12 & 10 ^ 6") == 14);
+    TEST_CHECK(constantValue("-2 * 3 + ~0 + 1") == std::uint64_t(-6));
+    TEST_CHECK(constantValue("0x10 + 0b11") == 19);
+
+    // Literal only sub-expressions fold to single term.
+    TEST_CHECK(gen_asm::compileExpression<std::uint64_t>("(1 + 2) * (3 << 1)").postfix.size() == 1);
+    TEST_CHECK(gen_asm::compileExpression<std::uint64_t>("-(4 / 2)").isConstant());
+    auto partial = gen_asm::compileExpression<std::uint64_t>("a + 2 * 3");
+    TEST_CHECK((partial.postfix.size() == 3) && (partial.symbols.size() == 1) && !partial.isConstant());
+
+    // Symbol operands, indexed symbols and repeated symbols.
+    TEST_CHECK(symbolValue("a + b * 2") == 16);
+    TEST_CHECK(symbolValue("(a - b) << 1") == 14);
+    TEST_CHECK(symbolValue("t[2][5] - t") == 25);
+    TEST_CHECK(symbolValue("t[1] + a") == 120);
+    TEST_CHECK(symbolValue("-a") == std::uint64_t(-10));
+    TEST_CHECK(gen_asm::compileExpression<std::uint64_t>("a + a").symbols.size() == 2);
+
+    // Signed division, modulo and arithmetic shift.
+    TEST_CHECK(signedValue("-7 / 2") == -3);
+    TEST_CHECK(signedValue("7 / -2") == -3);
+    TEST_CHECK(signedValue("-7 % 2") == -1);
+    TEST_CHECK(signedValue("7 % -2") == 1);
+    TEST_CHECK(signedValue("-8 >> 1") == -4);
+    TEST_CHECK(signedValue("-1 >> 70") == -1);
+    TEST_CHECK(constantValue("8 >> 70") == 0);
+    TEST_CHECK(constantValue("1 << 64") == 0);
+    TEST_CHECK(signedValue("(1 << 63) / -1") == std::numeric_limits<std::int64_t>::min());
+    TEST_CHECK(constantValue("(1 << 63) % -1") == 0);
+    TEST_CHECK(gen_asm::Expression<std::uint16_t>::apply(gen_asm::ExpressionOp::DIVIDE, std::uint16_t(-9), 4) == std::uint16_t(-2));
+
+    // Malformed expressions.
+    TEST_CHECK_THROWS((void)gen_asm::compileExpression<std::uint64_t>("(1 + 2"), std::invalid_argument);
+    TEST_CHECK_THROWS((void)gen_asm::compileExpression<std::uint64_t>("1 + 2)"), std::invalid_argument);
+    TEST_CHECK_THROWS((void)gen_asm::compileExpression<std::uint64_t>("1 +"), std::invalid_argument);
+    TEST_CHECK_THROWS((void)gen_asm::compileExpression<std::uint64_t>("a[1"), std::invalid_argument);
+    TEST_CHECK_THROWS((void)gen_asm::compileExpression<std::uint64_t>("a[]"), std::invalid_argument);
+    TEST_CHECK_THROWS((void)gen_asm::compileExpression<std::uint64_t>("1 # 2"), std::invalid_argument);
+    TEST_CHECK_THROWS((void)gen_asm::compileExpression<std::uint64_t>("0xZZ + 1"), std::invalid_argument);
+
+    // Folded division by zero, and division by zero at evaluation.
+    TEST_CHECK_THROWS((void)gen_asm::compileExpression<std::uint64_t>("1 / 0"), std::domain_error);
+    TEST_CHECK_THROWS((void)gen_asm::compileExpression<std::uint64_t>("1 % (2 - 2)"), std::domain_error);
+    TEST_CHECK_THROWS((void)symbolValue("a / (b - 3)"), std::domain_error);
+
+    // Evaluation stack depth is bounded.
+    std::string deep = "a";
+    for(std::size_t i = 0; i < gen_asm::literal::MAX_EXPRESSION_DEPTH; ++i)
+        deep = "a + (" + deep + ")";
+    TEST_CHECK_THROWS((void)gen_asm::compileExpression<std::uint64_t>(deep), std::invalid_argument);
+
+    return test::result();
+}
@@ -0,0 +1,141 @@
+/**
+ * @file localLabelTest.cpp 
+ * @author Harith Manoj (harithpub@gmail.com)
+ * @brief Tests of numeric local labels in single and two pass assembly.
+ * @date 17 October 2026
+ * 
+ * @copyright Copyright (C) 2024
+ * 
+ * 
+ *                      GNU GENERAL PUBLIC LICENSE 
+ *                        Version 3, 29 June 2007 
+ * 
+ * This program is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published by 
+ * the Free Software Foundation, either version 3 of the License, or 
+ * (at your option) any later version. 
+ *  
+ * This program is distributed in the hope that it will be useful, 
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details. 
+ *  
+ * You should have received a copy of the GNU General Public License 
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "../src/asm.cpp"
+
+#include <genAsmLib/localLabelTable.h>
+
+#include "testCheck.h"
+
+using Traits = risc16::AssemblerTraits;
+using Resolver = gen_asm::AddressResolver<Traits, Traits>;
+using Table = gen_asm::SymbolTable<Traits, Traits, Resolver>;
+
+int main()
+{
+    gen_asm::Tokenizer<Traits, Traits> tokenizer;
+
+    // References carry index of definition referred, also when symbols are not tokenized.
+    tokenizer.tokenize("1:", false);
+    tokenizer.tokenize("beq %r0, %r0, 1f");
+    TEST_CHECK(tokenizer.getInstruction().localLabelArgs[0].second.definition == 1);
+    tokenizer.tokenize("beq %r0, %r0, 1b");
+    TEST_CHECK(tokenizer.getInstruction().localLabelArgs[0].second.definition == 0);
+    TEST_CHECK_THROWS(tokenizer.tokenize("beq %r0, %r0, 2b"), std::invalid_argument);
+    tokenizer.resetLocalLabels();
+    TEST_CHECK_THROWS(tokenizer.tokenize("beq %r0, %r0, 1b"), std::invalid_argument);
+
+    // Local labels in expressions, not mistaken for numbers.
+    tokenizer.tokenize("1:");
+    tokenizer.tokenize("lui %r1, 1f + 2");
+    const auto& expression = tokenizer.getInstruction().expressionArgs.at(0).second;
+    TEST_CHECK((expression.localLabels.size() == 1) && expression.localLabels[0].isForward);
+    TEST_CHECK((expression.localLabels[0].number == 1) && (expression.localLabels[0].definition == 1));
+    tokenizer.tokenize("lui %r1, 0b11 + 1b");
+    TEST_CHECK(tokenizer.getInstruction().expressionArgs.at(0).second.localLabels.size() == 1);
+    TEST_CHECK_THROWS((void)gen_asm::compileExpression<std::uint64_t>("1f + 1").evaluate([](const auto&) { return 0; }), std::invalid_argument);
+    TEST_CHECK(gen_asm::compileExpression<std::uint64_t>("0x1f + 1").isConstant());
+    TEST_CHECK_THROWS((void)gen_asm::compileExpression<std::uint64_t>("65536f + 1"), std::invalid_argument);
+
+    // Two pass assembly through symbol table.
+    const std::vector<std::string_view> source = {
+        "1:",
+        "beq %r1, %r0, 1f",     // 0 -> 3
+        "beq %r1, %r0, 1b",     // 1 -> 0
+        "add %r1, %r1, %r1",    // 2
+        "1:",
+        "beq %r1, %r0, 1b",     // 3 -> 3
+        "lui %r2, 1b + 1",      // 4 -> 4
+        "lui %r2, 2f - 1b",     // 5 -> 8 - 3
+        "movi %r2, $0",         // 6, 7
+        "2:",
+        "jalr %r0, %r0"         // 8
+    };
+
+    Resolver resolver;
+    Table table(resolver);
+
+    for(auto line : source)
+    {
+        tokenizer.tokenize(line);
+        if(tokenizer.isSymbol())
+            table.addSymbol(0, tokenizer.getSymbol());
+        else
+            resolver.updateOffsets(tokenizer.getInstruction());
+    }
+
+    table.setBaseAddress(0x100, 0);
+    tokenizer.resetLocalLabels();
+
+    std::vector<std::uint64_t> targets;
+    for(auto line : source)
+    {
+        tokenizer.tokenize(line, false);
+        if(!tokenizer.isInstruction())
+            continue;
+
+        auto instr = tokenizer.getInstruction();
+        table.resolveOperands(0, instr);
+        TEST_CHECK(instr.operands.isResolved());
+        targets.push_back(instr.operands.values[instr.operands.count - 1]);
+    }
+
+    TEST_CHECK(targets.size() == 8);
+    TEST_CHECK((targets[0] == 0x103) && (targets[1] == 0x100) && (targets[3] == 0x103));
+    TEST_CHECK((targets[4] == 0x104) && (targets[5] == 5));
+
+    // Forward reference without following definition.
+    TEST_CHECK_THROWS((void)table.resolveLocalLabel(0, {1, true, 2}), std::invalid_argument);
+    TEST_CHECK_THROWS((void)table.resolveLocalLabel(1, {1, false, 0}), std::invalid_argument);
+
+    // Local labels never enter named columns.
+    TEST_CHECK(table.size() == 0);
+
+    // Single pass table keeps only label numbers used.
+    gen_asm::LocalLabelTable<std::uint16_t, std::size_t> locals;
+    std::vector<std::pair<std::size_t, std::uint16_t>> patched;
+    auto patch = [&](std::size_t fixup, std::uint16_t address) { patched.push_back({fixup, address}); };
+
+    TEST_CHECK(!locals.reference({65535, true, 0}, 7));
+    TEST_CHECK(locals.pendingCount() == 1);
+    locals.define(65535, 40, patch);
+    TEST_CHECK((patched.size() == 1) && (patched[0] == std::pair<std::size_t, std::uint16_t>{7, 40}));
+    TEST_CHECK(locals.reference({65535, false, 0}, 8) == std::uint16_t(40));
+    TEST_CHECK_THROWS((void)locals.reference({3, false, 0}, 9), std::invalid_argument);
+    (void)locals.reference({3, true, 0}, 10);
+    TEST_CHECK_THROWS(locals.finalize(), std::invalid_argument);
+    locals.clear();
+    TEST_CHECK(locals.pendingCount() == 0);
+
+    return test::result();
+}
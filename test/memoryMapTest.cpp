@@ -0,0 +1,117 @@
+/**
+ * @file memoryMapTest.cpp 
+ * @author Harith Manoj (harithpub@gmail.com)
+ * @brief Tests of memory map placement, free space and JSON output.
+ * @date 17 October 2026
+ * 
+ * @copyright Copyright (C) 2024
+ * 
+ * 
+ *                      GNU GENERAL PUBLIC LICENSE 
+ *                        Version 3, 29 June 2007 
+ * 
+ * This program is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published by 
+ * the Free Software Foundation, either version 3 of the License, or 
+ * (at your option) any later version. 
+ *  
+ * This program is distributed in the hope that it will be useful, 
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details. 
+ *  
+ * You should have received a copy of the GNU General Public License 
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+#include <string>
+
+#include "../src/asm.cpp"
+
+#include "testCheck.h"
+
+using Traits = risc16::AssemblerTraits;
+using Resolver = gen_asm::AddressResolver<Traits, Traits>;
+
+int main()
+{
+    // Placement, overlap queries and free space.
+    {
+        gen_asm::MemoryMap map(100);
+
+        map.place(10, 5, "a");
+        map.place(15, 5, "b");
+        map.place(50, 0, "empty");
+        map.place(90, 10, "end");
+
+        TEST_CHECK(map.size() == 3);
+        TEST_CHECK(!map.findOverlap(0, 10).has_value());
+        TEST_CHECK(!map.findOverlap(20, 70).has_value());
+        TEST_CHECK(map.findOverlap(14, 1)->name == "a");
+        TEST_CHECK(map.findOverlap(14, 2).has_value());
+        TEST_CHECK(map.findOverlap(16, 10)->name == "b");
+        TEST_CHECK(map.findOverlap(5, 90)->name == "a");
+        TEST_CHECK(!map.findOverlap(12, 0).has_value());
+
+        TEST_CHECK_THROWS(map.place(12, 10, "c"), std::domain_error);
+        TEST_CHECK_THROWS(map.place(5, 6, "c"), std::domain_error);
+        TEST_CHECK_THROWS(map.place(95, 10, "c"), std::out_of_range);
+        TEST_CHECK_THROWS(map.place(100, 1, "c"), std::out_of_range);
+        TEST_CHECK_THROWS(map.place(1, std::size_t(-1), "c"), std::out_of_range);
+        TEST_CHECK(map.size() == 3);
+
+        auto free = map.freeSpace();
+        TEST_CHECK((free.size() == 2) && (free[0].start == 0) && (free[0].end == 10) && (free[1].start == 20) && (free[1].end == 90));
+
+        TEST_CHECK(map.toJson() == 
+            "{\"spaceSize\": 100, \"regions\": ["
+            "{\"start\": 10, \"end\": 15, \"name\": \"a\"}, "
+            "{\"start\": 15, \"end\": 20, \"name\": \"b\"}, "
+            "{\"start\": 90, \"end\": 100, \"name\": \"end\"}"
+            "], \"free\": [{\"start\": 0, \"end\": 10}, {\"start\": 20, \"end\": 90}]}"
+        );
+    }
+
+    // Empty map is all free, names are escaped.
+    {
+        gen_asm::MemoryMap map(16);
+        TEST_CHECK(map.toJson() == "{\"spaceSize\": 16, \"regions\": [], \"free\": [{\"start\": 0, \"end\": 16}]}");
+
+        map.place(0, 16, std::string("q\"b\\n\n\x01", 7));
+        TEST_CHECK(map.toJson() == 
+            "{\"spaceSize\": 16, \"regions\": [{\"start\": 0, \"end\": 16, \"name\": \"q\\\"b\\\\n\\u000a\\u0001\"}], \"free\": []}"
+        );
+    }
+
+    // Maps of resolver after layout.
+    {
+        Resolver resolver;
+        gen_asm::Tokenizer<Traits, Traits> tokenizer;
+
+        for(auto line : {"add %r1, %r1, %r1", ".org 0x10", "movi %r1, $5", ".section .data", ".zero 4"})
+        {
+            tokenizer.tokenize(line);
+            if(tokenizer.isInstruction())
+                resolver.updateOffsets(tokenizer.getInstruction());
+            else
+                resolver.updateOffsets(tokenizer.getDirective());
+        }
+
+        resolver.layoutSections();
+
+        TEST_CHECK(resolver.getCodeMap().toJson() == 
+            "{\"spaceSize\": 65536, \"regions\": ["
+            "{\"start\": 0, \"end\": 1, \"name\": \".text\"}, "
+            "{\"start\": 16, \"end\": 18, \"name\": \".text@16\"}"
+            "], \"free\": [{\"start\": 1, \"end\": 16}, {\"start\": 18, \"end\": 65536}]}"
+        );
+        TEST_CHECK(resolver.getDataMap().toJson() == 
+            "{\"spaceSize\": 65536, \"regions\": [{\"start\": 0, \"end\": 4, \"name\": \".data\"}], "
+            "\"free\": [{\"start\": 4, \"end\": 65536}]}"
+        );
+    }
+
+    return test::result();
+}
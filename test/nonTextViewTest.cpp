@@ -0,0 +1,108 @@
+/**
+ * @file nonTextViewTest.cpp 
+ * @author Harith Manoj (harithpub@gmail.com)
+ * @brief Tests of lazy view of text not enclosed by quotes.
+ * @date 17 October 2026
+ * 
+ * @copyright Copyright (C) 2024
+ * 
+ * 
+ *                      GNU GENERAL PUBLIC LICENSE 
+ *                        Version 3, 29 June 2007 
+ * 
+ * This program is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published by 
+ * the Free Software Foundation, either version 3 of the License, or 
+ * (at your option) any later version. 
+ *  
+ * This program is distributed in the hope that it will be useful, 
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details. 
+ *  
+ * You should have received a copy of the GNU General Public License 
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <easyParseLib/easyParse.h>
+
+#include "testCheck.h"
+
+static_assert(std::ranges::forward_range<easyParse::NonTextView>);
+static_assert(std::ranges::view<easyParse::NonTextView>);
+
+/// @brief Non enclosed substrings collected from spans reported by `scanQuotedText`.
+std::vector<std::string_view> reference(std::string_view string)
+{
+    std::vector<std::string_view> ret;
+    std::size_t begin = 0;
+
+    bool isClosed = easyParse::scanQuotedText(
+        string,
+        [&](std::size_t spanBegin, std::size_t spanEnd)
+        {
+            if(spanBegin > begin)
+                ret.push_back(string.substr(begin, spanBegin - begin));
+            begin = spanEnd;
+        },
+        [](std::size_t) {}
+    );
+
+    if(isClosed && (begin < string.size()))
+        ret.push_back(string.substr(begin));
+
+    return ret;
+}
+
+int main()
+{
+    using Strings = std::vector<std::string_view>;
+
+    TEST_CHECK(easyParse::extractNonText(R"(hello"asd""asd"aa'a')") == Strings({"hello", "aa"}));
+    TEST_CHECK(easyParse::extractNonText(R"(a "b\"c" d)") == Strings({"a ", " d"}));
+    // Text after last closed quote is dropped if string ends inside quoted text.
+    TEST_CHECK(easyParse::extractNonText(R"('x' y 'z)").empty());
+    TEST_CHECK(easyParse::extractNonText(R"(\"a\" b)") == Strings({R"(\"a\" b)"}));
+    TEST_CHECK(easyParse::extractNonText("").empty());
+    TEST_CHECK(easyParse::extractNonText(R"("")").empty());
+
+    // Substrings are views into input, produced lazily.
+    std::string_view line = R"(mov "a" , 'b' ; c)";
+    auto view = easyParse::NonTextView(line);
+    auto iter = view.begin();
+    TEST_CHECK((*iter == "mov ") && ((*iter).data() == line.data()));
+    auto copy = iter++;
+    TEST_CHECK((*copy == "mov ") && (*iter == " , "));
+    TEST_CHECK(++iter != std::default_sentinel);
+    TEST_CHECK(*iter == " ; c");
+    TEST_CHECK(++iter == std::default_sentinel);
+    TEST_CHECK(std::ranges::distance(view) == 3);
+
+    // Every string over quote, escape and text characters agrees with span scanning.
+    constexpr std::string_view alphabet = "a\"'\\ ";
+    std::string string;
+    for(std::size_t length = 0; length <= 6; ++length)
+    {
+        std::size_t total = 1;
+        for(std::size_t i = 0; i < length; ++i)
+            total *= alphabet.size();
+
+        for(std::size_t code = 0; code < total; ++code)
+        {
+            string.clear();
+            for(std::size_t i = 0, rest = code; i < length; ++i, rest /= alphabet.size())
+                string += alphabet[rest % alphabet.size()];
+
+            TEST_CHECK(easyParse::extractNonText(string) == reference(string));
+        }
+    }
+
+    return test::result();
+}
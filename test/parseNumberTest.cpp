@@ -0,0 +1,109 @@
+/**
+ * @file parseNumberTest.cpp 
+ * @author Harith Manoj (harithpub@gmail.com)
+ * @brief Tests of number parsing, bases and overflow.
+ * @date 17 October 2026
+ * 
+ * @copyright Copyright (C) 2024
+ * 
+ * 
+ *                      GNU GENERAL PUBLIC LICENSE 
+ *                        Version 3, 29 June 2007 
+ * 
+ * This program is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published by 
+ * the Free Software Foundation, either version 3 of the License, or 
+ * (at your option) any later version. 
+ *  
+ * This program is distributed in the hope that it will be useful, 
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details. 
+ *  
+ * You should have received a copy of the GNU General Public License 
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+#include <cstdint>
+#include <string_view>
+#include <system_error>
+
+#include <easyParseLib/easyParse.h>
+
+#include "testCheck.h"
+
+/// @brief Check parse of text gives value, error and number of consumed characters.
+template<class UInteger>
+bool parsesTo(std::string_view text, UInteger value, std::errc ec, std::size_t consumed)
+{
+    auto result = easyParse::parseNumber<UInteger>(text);
+    return (result.value == value) && (result.ec == ec) && (result.ptr == text.data() + consumed);
+}
+
+int main()
+{
+    using easyParse::parseNumber;
+
+    // Bases selected by prefix.
+    TEST_CHECK(parsesTo<std::uint16_t>("1234", 1234, std::errc{}, 4));
+    TEST_CHECK(parsesTo<std::uint16_t>("0x1aF", 0x1AF, std::errc{}, 5));
+    TEST_CHECK(parsesTo<std::uint16_t>("0XFF", 0xFF, std::errc{}, 4));
+    TEST_CHECK(parsesTo<std::uint16_t>("017", 017, std::errc{}, 3));
+    TEST_CHECK(parsesTo<std::uint16_t>("0b101", 5, std::errc{}, 5));
+    TEST_CHECK(parsesTo<std::uint16_t>("0B11", 3, std::errc{}, 4));
+    TEST_CHECK(parsesTo<std::uint16_t>("0", 0, std::errc{}, 1));
+
+    // Negative numbers are 2's complement.
+    TEST_CHECK(parsesTo<std::uint16_t>("-1", 0xFFFF, std::errc{}, 2));
+    TEST_CHECK(parsesTo<std::uint16_t>("-0x10", 0xFFF0, std::errc{}, 5));
+
+    // Negative magnitude is limited to signed range.
+    TEST_CHECK(parsesTo<std::uint16_t>("-32768", 0x8000, std::errc{}, 6));
+    TEST_CHECK(parsesTo<std::uint16_t>("-32769", 0, std::errc::result_out_of_range, 6));
+    TEST_CHECK(parsesTo<std::uint16_t>("-40000", 0, std::errc::result_out_of_range, 6));
+    TEST_CHECK(parsesTo<std::uint16_t>("-0xFFFF", 0, std::errc::result_out_of_range, 7));
+    TEST_CHECK(parsesTo<std::uint8_t>("-128", 0x80, std::errc{}, 4));
+    TEST_CHECK(parsesTo<std::uint8_t>("-129", 0, std::errc::result_out_of_range, 4));
+    TEST_CHECK(parsesTo<std::uint64_t>("-9223372036854775808", 0x8000000000000000, std::errc{}, 20));
+    TEST_CHECK(parsesTo<std::uint64_t>("-9223372036854775809", 0, std::errc::result_out_of_range, 20));
+
+    // Parsing stops at first character not valid for base.
+    TEST_CHECK(parsesTo<std::uint16_t>("12, 3", 12, std::errc{}, 2));
+    TEST_CHECK(parsesTo<std::uint16_t>("08", 0, std::errc{}, 1));
+    TEST_CHECK(parsesTo<std::uint16_t>("0b102", 2, std::errc{}, 4));
+    TEST_CHECK(parsesTo<std::uint16_t>("0xg", 0, std::errc{}, 1));
+    TEST_CHECK(parsesTo<std::uint16_t>("0b", 0, std::errc{}, 1));
+
+    // No digits.
+    TEST_CHECK(parsesTo<std::uint16_t>("", 0, std::errc::invalid_argument, 0));
+    TEST_CHECK(parsesTo<std::uint16_t>("-", 0, std::errc::invalid_argument, 0));
+    TEST_CHECK(parsesTo<std::uint16_t>("x1", 0, std::errc::invalid_argument, 0));
+
+    // Largest values fit, one more overflows with all digits consumed.
+    TEST_CHECK(parsesTo<std::uint8_t>("255", 255, std::errc{}, 3));
+    TEST_CHECK(parsesTo<std::uint8_t>("256", 0, std::errc::result_out_of_range, 3));
+    TEST_CHECK(parsesTo<std::uint8_t>("0xFF", 0xFF, std::errc{}, 4));
+    TEST_CHECK(parsesTo<std::uint8_t>("0x100", 0, std::errc::result_out_of_range, 5));
+    TEST_CHECK(parsesTo<std::uint8_t>("0377", 0377, std::errc{}, 4));
+    TEST_CHECK(parsesTo<std::uint8_t>("0400", 0, std::errc::result_out_of_range, 4));
+    TEST_CHECK(parsesTo<std::uint8_t>("0b111111111", 0, std::errc::result_out_of_range, 11));
+    TEST_CHECK(parsesTo<std::uint64_t>("18446744073709551615", UINT64_MAX, std::errc{}, 20));
+    TEST_CHECK(parsesTo<std::uint64_t>("18446744073709551616", 0, std::errc::result_out_of_range, 20));
+    TEST_CHECK(parsesTo<std::uint64_t>("99999999999999999999999", 0, std::errc::result_out_of_range, 23));
+
+    // Throwing and validating wrappers.
+    TEST_CHECK(easyParse::convertNumberString<std::uint16_t>("0x10") == 16);
+    TEST_CHECK_THROWS((void)easyParse::convertNumberString<std::uint8_t>("300"), std::out_of_range);
+    TEST_CHECK_THROWS((void)easyParse::convertNumberString<std::uint16_t>("12a"), std::invalid_argument);
+    TEST_CHECK_THROWS((void)easyParse::convertNumberString<std::uint16_t>(""), std::invalid_argument);
+    TEST_CHECK(easyParse::validateNumberString("0b1010"));
+    TEST_CHECK(!easyParse::validateNumberString("0b12"));
+    TEST_CHECK(!easyParse::validateNumberString(""));
+
+    static_assert(parseNumber<std::uint16_t>("0x7fff").value == 0x7FFF);
+    static_assert(parseNumber<std::uint8_t>("1000").ec == std::errc::result_out_of_range);
+
+    return test::result();
+}
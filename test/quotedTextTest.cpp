@@ -0,0 +1,105 @@
+/**
+ * @file quotedTextTest.cpp 
+ * @author Harith Manoj (harithpub@gmail.com)
+ * @brief Tests of advancing over text while skipping quoted text.
+ * @date 17 October 2026
+ * 
+ * @copyright Copyright (C) 2024
+ * 
+ * 
+ *                      GNU GENERAL PUBLIC LICENSE 
+ *                        Version 3, 29 June 2007 
+ * 
+ * This program is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published by 
+ * the Free Software Foundation, either version 3 of the License, or 
+ * (at your option) any later version. 
+ *  
+ * This program is distributed in the hope that it will be useful, 
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details. 
+ *  
+ * You should have received a copy of the GNU General Public License 
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <easyParseLib/easyParse.h>
+
+#include "testCheck.h"
+
+/// @brief Characters reported by `advanceAndIgnoreQuotedText` until end of string.
+std::string unquoted(std::string_view string)
+{
+    std::string ret;
+    auto iterator = string.begin();
+
+    while(true)
+    {
+        char ch = easyParse::advanceAndIgnoreQuotedText(iterator, string.end());
+        if(ch == -1)
+            return ret;
+        ret += ch;
+    }
+}
+
+/// @brief Characters and skip flags reported by `advanceSkipReportQuotedText` until end of string.
+std::vector<std::pair<char, bool>> reported(std::string_view string)
+{
+    std::vector<std::pair<char, bool>> ret;
+    auto iterator = string.begin();
+
+    while(true)
+    {
+        auto eval = easyParse::advanceSkipReportQuotedText(iterator, string.end());
+        if(eval.first == -1)
+            return ret;
+        ret.push_back(eval);
+    }
+}
+
+int main()
+{
+    static_assert(noexcept(easyParse::advanceAndIgnoreQuotedText(
+        std::declval<std::string_view::const_iterator&>(), std::string_view::const_iterator{}
+    )));
+
+    // Quoted text skipped, escaped quotes do not close it.
+    TEST_CHECK(unquoted(R"(hello"asd""asd"aa'a')") == "helloaa");
+    TEST_CHECK(unquoted(R"(a"b\"c"d)") == "ad");
+    TEST_CHECK(unquoted(R"(a'"'b)") == "ab");
+    TEST_CHECK(unquoted(R"(a"unclosed)") == "a");
+
+    // Escapes outside quotes are reported as \, never decoded.
+    TEST_CHECK(unquoted(R"(a\nb)") == R"(a\b)");
+    TEST_CHECK(unquoted(R"(a\:b)") == R"(a\b)");
+    TEST_CHECK(unquoted(R"(\"a")") == R"(\a)");
+    TEST_CHECK(unquoted(R"(ab\)") == R"(ab\)");
+
+    // Malformed escapes do not throw.
+    TEST_CHECK(unquoted(R"(a\x)") == R"(a\)");
+    TEST_CHECK(unquoted(R"(a\xZ)") == R"(a\Z)");
+    TEST_CHECK(unquoted(R"('\x'b)") == "b");
+
+    // Skip flag is set for character following skipped quoted text.
+    using Reported = std::vector<std::pair<char, bool>>;
+    TEST_CHECK(reported(R"(a"x"b)") == Reported({{'a', false}, {'b', true}}));
+    TEST_CHECK(reported(R"(a\'b)") == Reported({{'a', false}, {'\\', false}, {'b', false}}));
+
+    // Decoding of escapes stays with advanceOverText, which throws on malformed escapes.
+    std::string_view escape = R"(\n)";
+    auto iterator = escape.begin();
+    TEST_CHECK((easyParse::advanceOverText(iterator, escape.end()) == std::pair<char, bool>{'\n', true}));
+    std::string_view malformed = R"(\x)";
+    iterator = malformed.begin();
+    TEST_CHECK_THROWS((void)easyParse::advanceOverText(iterator, malformed.end()), std::invalid_argument);
+
+    return test::result();
+}
@@ -0,0 +1,386 @@
+/**
+ * @file relaxationTest.cpp 
+ * @author Harith Manoj (harithpub@gmail.com)
+ * @brief Tests of branch relaxation reaching its fixed point.
+ * @date 17 October 2026
+ * 
+ * @copyright Copyright (C) 2024
+ * 
+ * 
+ *                      GNU GENERAL PUBLIC LICENSE 
+ *                        Version 3, 29 June 2007 
+ * 
+ * This program is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published by 
+ * the Free Software Foundation, either version 3 of the License, or 
+ * (at your option) any later version. 
+ *  
+ * This program is distributed in the hope that it will be useful, 
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details. 
+ *  
+ * You should have received a copy of the GNU General Public License 
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <genAsmLib/relaxation.h>
+
+#include "../src/asm.cpp"
+
+#include "testCheck.h"
+
+/// @brief ISA with a 1 word short branch reaching 7 bit displacements, and a 5 word long form.
+struct TestTraits
+{
+    using BasicType = std::uint16_t;
+    using LargestType = std::uint64_t;
+    using WordType = std::uint16_t;
+    using AddressType = std::uint16_t;
+    using BlockSizeType = std::uint8_t;
+    using RegisterCodeType = std::uint8_t;
+    using ModifierCodeType = std::uint8_t;
+    using OpCodeType = std::uint8_t;
+
+    static constexpr OpCodeType PLAIN = 0;
+    static constexpr OpCodeType BRANCH = 1;
+    static constexpr OpCodeType LOAD = 2;
+
+    static constexpr std::size_t LONG_BRANCH = 5;
+
+    static bool fits(std::int64_t value) noexcept { return (value >= -64) && (value <= 63); }
+
+    static std::size_t getMinInstrWidth(OpCodeType) noexcept { return 1; }
+
+    static std::size_t getRelaxedWidth(OpCodeType op, LargestType target, AddressType address) noexcept
+    {
+        switch (op)
+        {
+        case BRANCH:
+            return fits(std::int64_t(target) - address - 1) ? 1 : LONG_BRANCH;
+        case LOAD:
+            return fits(std::int64_t(target)) ? 1 : 2;
+        default:
+            return 1;
+        }
+    }
+
+    static bool isPcRelative(OpCodeType op) noexcept { return op == BRANCH; }
+};
+
+using Item = gen_asm::RelaxationItem<TestTraits>;
+
+/// @brief Check every width is the one chosen at its final address, and addresses are prefix sums of widths.
+bool isFixedPoint(const std::vector<Item>& items, const std::vector<std::size_t>& labels, const gen_asm::RelaxationResult& result)
+{
+    std::size_t address = result.addresses.empty() ? 0 : result.addresses[0];
+
+    for(std::size_t i = 0; i < items.size(); ++i)
+    {
+        if(result.addresses[i] != address)
+            return false;
+
+        auto target = (items[i].targetLabel == gen_asm::literal::NO_RELAXATION_TARGET) ? 
+            items[i].value : result.labelAddresses[items[i].targetLabel];
+
+        if(result.widths[i] != TestTraits::getRelaxedWidth(items[i].opCode, target, static_cast<std::uint16_t>(address)))
+            return false;
+
+        address += result.widths[i];
+    }
+
+    for(std::size_t l = 0; l < labels.size(); ++l)
+    {
+        auto expected = (labels[l] == items.size()) ? address : result.addresses[labels[l]];
+        if(result.labelAddresses[l] != expected)
+            return false;
+    }
+
+    return true;
+}
+
+/// @brief Widths by relaxing from shortest forms, laying whole section out again after every change.
+std::vector<std::size_t> relaxByRelayout(const std::vector<Item>& items, const std::vector<std::size_t>& labels)
+{
+    std::vector<std::size_t> widths(items.size(), 1);
+
+    for(bool changed = true; changed;)
+    {
+        changed = false;
+
+        std::vector<std::size_t> addresses(items.size() + 1, 0);
+        for(std::size_t i = 0; i < items.size(); ++i)
+            addresses[i + 1] = addresses[i] + widths[i];
+
+        for(std::size_t i = 0; i < items.size(); ++i)
+        {
+            auto target = (items[i].targetLabel == gen_asm::literal::NO_RELAXATION_TARGET) ? 
+                items[i].value : addresses[labels[items[i].targetLabel]];
+            auto width = TestTraits::getRelaxedWidth(items[i].opCode, target, static_cast<std::uint16_t>(addresses[i]));
+
+            if(width > widths[i])
+            {
+                widths[i] = width;
+                changed = true;
+            }
+        }
+    }
+
+    return widths;
+}
+
+using Risc16 = risc16::AssemblerTraits;
+using Resolver = gen_asm::AddressResolver<Risc16, Risc16>;
+using Table = gen_asm::SymbolTable<Risc16, Risc16, Resolver>;
+using Instruction = gen_asm::InstructionToken<Risc16>;
+
+/// @brief Tokenize source of unit 0 at standard widths, returning its instructions.
+std::vector<Instruction> tokenize(Resolver& resolver, Table& table, const std::vector<std::string>& source)
+{
+    gen_asm::Tokenizer<Risc16, Risc16> tokenizer;
+    std::vector<Instruction> instrs;
+
+    for(const auto& line : source)
+    {
+        tokenizer.tokenize(line);
+
+        if(tokenizer.isSymbol())
+            table.addSymbol(0, tokenizer.getSymbol());
+        else if(tokenizer.isInstruction())
+        {
+            instrs.push_back(tokenizer.getInstruction());
+            resolver.updateOffsets(instrs.back());
+        }
+        else if(tokenizer.isDirective())
+            resolver.updateOffsets(tokenizer.getDirective());
+    }
+
+    return instrs;
+}
+
+/// @brief Run RISC-16 words from address 0 until pc leaves them, returning registers.
+std::array<std::uint16_t, 8> run(const std::vector<std::uint16_t>& code)
+{
+    std::array<std::uint16_t, 8> regs{};
+    std::vector<std::uint16_t> memory(0x10000);
+
+    for(std::size_t pc = 0, steps = 0; (pc < code.size()) && (steps < 10000); ++steps)
+    {
+        auto word = code[pc];
+        auto a = (word >> 10) & 7;
+        auto b = (word >> 7) & 7;
+        auto c = word & 7;
+        auto imm = static_cast<std::uint16_t>(static_cast<std::int16_t>((word & 0x7F) << 9) >> 9);
+        auto next = pc + 1;
+
+        switch (word >> 13)
+        {
+        case 0: regs[a] = regs[b] + regs[c]; break;
+        case 1: regs[a] = regs[b] + imm; break;
+        case 2: regs[a] = ~(regs[b] & regs[c]); break;
+        case 3: regs[a] = (word & 0x3FF) << 6; break;
+        case 4: memory[std::uint16_t(regs[b] + imm)] = regs[a]; break;
+        case 5: regs[a] = memory[std::uint16_t(regs[b] + imm)]; break;
+        case 6: if(regs[a] == regs[b]) next = std::uint16_t(pc + 1 + imm); break;
+        default: next = regs[b]; regs[a] = std::uint16_t(pc + 1); break;
+        }
+
+        regs[0] = 0;
+        pc = next;
+    }
+
+    return regs;
+}
+
+int main()
+{
+    constexpr auto NONE = gen_asm::literal::NO_RELAXATION_TARGET;
+    TestTraits traits;
+
+    // 20 branches to a label after them: out of reach if all were long (100 words), in reach once short.
+    {
+        std::vector<Item> items(20, Item{TestTraits::BRANCH, 0, 0});
+        std::vector<std::size_t> labels = {items.size()};
+
+        auto result = gen_asm::relaxInstructions<TestTraits>(traits, std::span<const Item>(items), std::span<const std::size_t>(labels));
+
+        TEST_CHECK(isFixedPoint(items, labels, result));
+        TEST_CHECK(std::ranges::all_of(result.widths, [](auto width) { return width == 1; }));
+        TEST_CHECK(result.labelAddresses[0] == 20);
+    }
+
+    // Branch over 100 words stays long, branches around it converge to short.
+    {
+        std::vector<Item> items;
+        items.push_back({TestTraits::BRANCH, 0, 0});
+        items.push_back({TestTraits::BRANCH, 1, 0});
+        for(int i = 0; i < 100; ++i)
+            items.push_back({TestTraits::PLAIN, NONE, 0});
+        items.push_back({TestTraits::BRANCH, 1, 0});
+
+        std::vector<std::size_t> labels = {2, items.size()};
+
+        auto result = gen_asm::relaxInstructions<TestTraits>(traits, std::span<const Item>(items), std::span<const std::size_t>(labels), 0x100);
+
+        TEST_CHECK(isFixedPoint(items, labels, result));
+        TEST_CHECK(result.widths[0] == 1);
+        TEST_CHECK(result.widths[1] == TestTraits::LONG_BRANCH);
+        TEST_CHECK(result.widths.back() == 1);
+        TEST_CHECK(result.labelAddresses[0] == 0x100 + 1 + TestTraits::LONG_BRANCH);
+    }
+
+    // Growth cascading: each long branch pushes the previous one just out of reach.
+    {
+        std::vector<Item> items;
+        for(int i = 0; i < 4; ++i)
+        {
+            items.push_back({TestTraits::BRANCH, 0, 0});
+            for(int j = 0; j < 15; ++j)
+                items.push_back({TestTraits::PLAIN, NONE, 0});
+        }
+        items.push_back({TestTraits::LOAD, NONE, 100});
+
+        std::vector<std::size_t> labels = {items.size()};
+
+        auto result = gen_asm::relaxInstructions<TestTraits>(traits, std::span<const Item>(items), std::span<const std::size_t>(labels));
+
+        TEST_CHECK(isFixedPoint(items, labels, result));
+        TEST_CHECK(result.widths == relaxByRelayout(items, labels));
+        TEST_CHECK(result.widths.back() == 2);
+    }
+
+    // Random sections agree with relaxing by full relayout.
+    std::mt19937 random(16);
+
+    for(int round = 0; round < 50; ++round)
+    {
+        std::size_t count = 50 + random() % 500;
+        std::vector<std::size_t> labels(1 + random() % 20);
+        for(auto& label : labels)
+            label = random() % (count + 1);
+
+        std::vector<Item> items(count);
+        for(auto& item : items)
+        {
+            switch (random() % 4)
+            {
+            case 0:
+                item = {TestTraits::BRANCH, random() % labels.size(), 0};
+                break;
+            case 1:
+                item = {TestTraits::LOAD, NONE, random() % 128};
+                break;
+            default:
+                item = {TestTraits::PLAIN, NONE, 0};
+                break;
+            }
+        }
+
+        auto result = gen_asm::relaxInstructions<TestTraits>(traits, std::span<const Item>(items), std::span<const std::size_t>(labels));
+
+        TEST_CHECK(isFixedPoint(items, labels, result));
+        TEST_CHECK(result.widths == relaxByRelayout(items, labels));
+    }
+
+    std::vector<Item> badLabel = {{TestTraits::BRANCH, 3, 0}};
+    std::vector<std::size_t> labels = {0};
+    TEST_CHECK_THROWS(gen_asm::relaxInstructions<TestTraits>(traits, std::span<const Item>(badLabel), std::span<const std::size_t>(labels)), std::out_of_range);
+
+    // Relaxed section of symbol table and resolver, encoded at its widths, runs as written.
+    {
+        Resolver resolver;
+        Table table(resolver);
+
+        std::vector<std::string> source = {
+            "start:",
+            "movi %r2, $0x100",
+            "movi %r1, $5",
+            "loop:",
+            "addi %r5, %r5, $3",
+            "addi %r1, %r1, $-1",
+            "beq %r1, %r0, 1f",
+            "beq %r0, %r0, loop",
+            "1:",
+            "call far",
+            "beq %r0, %r0, end",
+            "far:",
+            "movi %r4, $0x1234",
+            "push %r4",
+            "pop %r6",
+            "ret"
+        };
+        source.insert(source.end(), 80, "add %r0, %r0, %r0");
+        source.push_back("end:");
+
+        auto instrs = tokenize(resolver, table, source);
+        auto standardSize = resolver.getCodeAddressOffset();
+
+        auto result = gen_asm::relaxCodeSection<Risc16>(Risc16{}, table, resolver, 0, 0, std::span<const Instruction>(instrs));
+        resolver.layoutSections();
+
+        TEST_CHECK((std::vector<std::size_t>(result.widths.begin(), result.widths.begin() + 12) 
+            == std::vector<std::size_t>{1, 1, 1, 1, 1, 1, 2, 5, 2, 2, 2, 1}));
+        // movi, movi and call shrink by one each, far beq grows by four.
+        TEST_CHECK(resolver.getCodeAddressOffset() == standardSize + 1);
+        TEST_CHECK(table.resolveSymbol(0, {"far"}) == 13);
+        TEST_CHECK(table.resolveSymbol(0, {"end"}) == resolver.getCodeAddressOffset());
+
+        std::vector<std::uint16_t> code(resolver.getCodeAddressOffset());
+        for(std::size_t i = 0; i < instrs.size(); ++i)
+        {
+            auto instr = instrs[i];
+            table.resolveOperands(0, instr);
+
+            // Label targets of beq become displacements, literal ones already are.
+            if(Risc16::isPcRelative(instr.opCode) && !(instr.symbolArgs.empty() && instr.localLabelArgs.empty()))
+                instr.operands.values[2] -= result.addresses[i] + 1;
+
+            risc16::EncoderTraits::encodeRelaxedInstruction(
+                instr.opCode, instr.operands.view(), static_cast<std::uint16_t>(result.addresses[i]),
+                std::span(code).subspan(result.addresses[i], result.widths[i])
+            );
+        }
+
+        auto regs = run(code);
+        TEST_CHECK((regs[1] == 0) && (regs[5] == 15) && (regs[2] == 0x100));
+        TEST_CHECK((regs[4] == 0x1234) && (regs[6] == 0x1234));
+    }
+
+    // Sections not filled by instructions, with displacements not reaching an instruction, or holding fills, are not relaxed.
+    {
+        Resolver resolver;
+        Table table(resolver);
+
+        auto instrs = tokenize(resolver, table, {"add %r1, %r1, %r1", "beq %r0, %r0, $5"});
+        TEST_CHECK_THROWS(
+            gen_asm::relaxCodeSection<Risc16>(Risc16{}, table, resolver, 0, 0, std::span<const Instruction>(instrs).first(1)), 
+            std::invalid_argument
+        );
+        TEST_CHECK_THROWS(
+            gen_asm::relaxCodeSection<Risc16>(Risc16{}, table, resolver, 0, 0, std::span<const Instruction>(instrs)), 
+            std::invalid_argument
+        );
+    }
+
+    {
+        Resolver resolver;
+        Table table(resolver);
+
+        auto instrs = tokenize(resolver, table, {"add %r1, %r1, %r1", ".align 4"});
+        instrs.resize(4, instrs[0]);
+        TEST_CHECK_THROWS(
+            gen_asm::relaxCodeSection<Risc16>(Risc16{}, table, resolver, 0, 0, std::span<const Instruction>(instrs)), 
+            std::domain_error
+        );
+    }
+
+    return test::result();
+}
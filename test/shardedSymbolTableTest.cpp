@@ -0,0 +1,176 @@
+/**
+ * @file shardedSymbolTableTest.cpp 
+ * @author Harith Manoj (harithpub@gmail.com)
+ * @brief Tests of export conflicts and resolution of sharded symbol table.
+ * @date 17 October 2026
+ * 
+ * @copyright Copyright (C) 2024
+ * 
+ * 
+ *                      GNU GENERAL PUBLIC LICENSE 
+ *                        Version 3, 29 June 2007 
+ * 
+ * This program is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published by 
+ * the Free Software Foundation, either version 3 of the License, or 
+ * (at your option) any later version. 
+ *  
+ * This program is distributed in the hope that it will be useful, 
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details. 
+ *  
+ * You should have received a copy of the GNU General Public License 
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../src/asm.cpp"
+#include <genAsmLib/shardedSymbolTable.h>
+
+#include "testCheck.h"
+
+using Traits = risc16::AssemblerTraits;
+using Resolver = gen_asm::AddressResolver<Traits, Traits>;
+using Table = gen_asm::ShardedSymbolTable<Traits, Traits, Resolver>;
+
+gen_asm::SymbolToken<Traits> symbol(std::string_view line)
+{
+    gen_asm::Tokenizer<Traits, Traits> tokenizer;
+    tokenizer.tokenize(line);
+    return tokenizer.getSymbol();
+}
+
+int main()
+{
+    constexpr std::size_t UNITS = 8;
+
+    // Same export added by every unit at once is won by exactly one.
+    for(int round = 0; round < 20; ++round)
+    {
+        Table table(UNITS);
+        std::atomic<std::size_t> conflicts = 0;
+        std::atomic<std::size_t> winner = UNITS;
+
+        std::vector<std::thread> threads;
+        for(std::size_t unit = 0; unit < UNITS; ++unit)
+        {
+            threads.emplace_back([&, unit]
+            {
+                auto shared = symbol("shared: .export");
+                auto own = symbol("own" + std::to_string(unit) + ": .export");
+
+                table.addSymbol(unit, own);
+
+                try
+                {
+                    table.addSymbol(unit, shared);
+                    winner = unit;
+                }
+                catch(const std::domain_error&)
+                {
+                    ++conflicts;
+                }
+            });
+        }
+
+        for(auto& thread : threads)
+            thread.join();
+
+        TEST_CHECK(conflicts == UNITS - 1);
+        TEST_CHECK(winner < UNITS);
+        TEST_CHECK(table.shard(winner).contains("shared", winner));
+
+        for(std::size_t unit = 0; unit < UNITS; ++unit)
+            TEST_CHECK(table.shard(unit).contains("shared", unit) == (unit == winner));
+
+        table.finalize();
+    }
+
+    // Failed adds release their export reservation.
+    {
+        Table table(2);
+
+        table.addSymbol(0, symbol("name:"));
+        TEST_CHECK_THROWS(table.addSymbol(0, symbol("name: .export")), std::domain_error);
+        table.addSymbol(1, symbol("name: .export"));
+        TEST_CHECK_THROWS(table.finalize(), std::domain_error);
+
+        std::vector<gen_asm::BatchSymbol<Traits>> batch = {
+            {symbol("first: .export"), 0, 0},
+            {symbol("dup:"), 0, 0},
+            {symbol("dup:"), 0, 0}
+        };
+        TEST_CHECK_THROWS(table.addSymbols(0, batch), std::domain_error);
+
+        batch.pop_back();
+        table.addSymbols(1, batch);
+        TEST_CHECK(table.shard(1).contains("first", 1) && !table.shard(0).contains("first", 0));
+    }
+
+    // Exports resolve from every unit, locals shadow nothing of other units, concurrently.
+    {
+        Table table(UNITS);
+        gen_asm::Tokenizer<Traits, Traits> tokenizer;
+
+        for(std::size_t unit = 0; unit < UNITS; ++unit)
+        {
+            for(std::size_t i = 0; i <= unit; ++i)
+            {
+                tokenizer.tokenize("add %r1, %r1, %r1");
+                table.resolver(unit).updateOffsets(tokenizer.getInstruction());
+            }
+
+            table.addSymbol(unit, symbol("local:"));
+            table.addSymbol(unit, symbol("entry" + std::to_string(unit) + ": .export"));
+        }
+
+        table.finalize();
+        table.assignBaseAddresses(0x100, 0, 3);
+
+        // Unit u has u + 1 instructions, so its labels are at 0x100 + sum of sizes before it, plus its own size.
+        auto labelOf = [](std::size_t unit) { return 0x100 + (unit * (unit + 1)) / 2 + unit + 1; };
+
+        std::atomic<std::size_t> mismatches = 0;
+        std::vector<std::thread> threads;
+
+        for(std::size_t unit = 0; unit < UNITS; ++unit)
+        {
+            threads.emplace_back([&, unit]
+            {
+                for(int i = 0; i < 500; ++i)
+                {
+                    auto other = (unit + i) % UNITS;
+                    auto name = "entry" + std::to_string(other);
+
+                    mismatches += table.resolveSymbol(unit, {name}) != labelOf(other);
+                    mismatches += table.resolveSymbol(unit, {"local"}) != labelOf(unit);
+                }
+            });
+        }
+
+        for(auto& thread : threads)
+            thread.join();
+
+        TEST_CHECK(mismatches == 0);
+        TEST_CHECK(table.getStats().jumpSymbols == 2 * UNITS);
+        TEST_CHECK_THROWS((void)table.resolveSymbol(0, {"missing"}), std::invalid_argument);
+
+        // Text of every unit is placed right before its labels.
+        auto [code, data] = table.buildMemoryMaps();
+        TEST_CHECK(code.size() == UNITS);
+        for(std::size_t unit = 0; unit < UNITS; ++unit)
+        {
+            auto region = code.findOverlap(labelOf(unit) - 1, 1);
+            TEST_CHECK(region && (region->name == std::to_string(unit) + ":.text") && (region->end == labelOf(unit)));
+        }
+    }
+
+    return test::result();
+}
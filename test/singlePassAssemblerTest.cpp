@@ -0,0 +1,177 @@
+/**
+ * @file singlePassAssemblerTest.cpp 
+ * @author Harith Manoj (harithpub@gmail.com)
+ * @brief Tests of single pass assembly into RISC-16 words.
+ * @date 17 October 2026
+ * 
+ * @copyright Copyright (C) 2024
+ * 
+ * 
+ *                      GNU GENERAL PUBLIC LICENSE 
+ *                        Version 3, 29 June 2007 
+ * 
+ * This program is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published by 
+ * the Free Software Foundation, either version 3 of the License, or 
+ * (at your option) any later version. 
+ *  
+ * This program is distributed in the hope that it will be useful, 
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details. 
+ *  
+ * You should have received a copy of the GNU General Public License 
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../src/asm.cpp"
+
+#include "testCheck.h"
+
+using Traits = risc16::AssemblerTraits;
+using Resolver = gen_asm::AddressResolver<Traits, Traits>;
+using Table = gen_asm::SymbolTable<Traits, Traits, Resolver>;
+using Assembler = gen_asm::SinglePassAssembler<Traits, Traits, Traits, Resolver, risc16::EncoderTraits>;
+
+struct LineReader
+{
+    std::vector<std::string> lines;
+    std::size_t next = 0;
+
+    bool eof() const { return next >= lines.size(); }
+    std::string read() { return lines[next++]; }
+};
+
+std::uint16_t encode(std::uint8_t op, std::uint64_t a, std::uint64_t b, std::uint64_t c)
+{
+    return risc16::encoding::encode(op, std::array<std::uint64_t, 3>{a, b, c});
+}
+
+std::uint16_t encode(std::uint8_t op, std::uint64_t a, std::uint64_t b)
+{
+    return risc16::encoding::encode(op, std::array<std::uint64_t, 2>{a, b});
+}
+
+int main()
+{
+    // Words of every instruction, fixups patched after layout.
+    {
+        Resolver resolver;
+        Table table(resolver);
+        table.setBaseAddress(0x100, 0);
+
+        Assembler assembler(table, resolver, 0);
+
+        LineReader reader{{
+            "start:",
+            "beq %r0, %r0, end",
+            "movi %r1, $0x1234",
+            "lw %r2, %r0, buf[1]",
+            "1:",
+            "beq %r1, %r0, 1f",
+            "beq %r0, %r0, 1b",
+            "push %r1",
+            "pop %r2",
+            "call start",
+            "ret",
+            "1:",
+            "end:",
+            "addi %r1, %r1, $-1",
+            ".align 4",
+            "nand %r1, %r2, %r3",
+            "buf: .data .word [2]"
+        }};
+
+        for(std::size_t i = 0; i < 7; ++i)
+            assembler.assembleLine(reader.read());
+
+        TEST_CHECK(assembler.pendingCount() == 4);
+        TEST_CHECK_THROWS((void)assembler.takeOutput(1), std::logic_error);
+
+        assembler.assemble(reader);
+        TEST_CHECK(assembler.pendingCount() == 0);
+
+        const std::vector<std::uint16_t> expected = {
+            encode(6, 0, 0, 13),                    // beq end
+            encode(3, 1, 0x1234 >> 6),              // movi
+            encode(1, 1, 1, 0x34),
+            encode(4, 2, 0, 1),                     // lw buf[1]
+            encode(6, 1, 0, 9),                     // beq 1f
+            encode(6, 0, 0, std::uint64_t(-2)),     // beq 1b
+            encode(1, 2, 2, std::uint64_t(-1)),     // push
+            encode(5, 1, 2, 0),
+            encode(4, 2, 2, 0),                     // pop
+            encode(1, 2, 2, 1),
+            encode(3, 3, 0x100 >> 6),               // call start
+            encode(1, 3, 3, 0),
+            encode(7, 3, 3),
+            encode(7, 0, 3),                        // ret
+            encode(1, 1, 1, std::uint64_t(-1)),     // end
+            0,                                      // .align 4
+            encode(2, 1, 2, 3)
+        };
+
+        const auto& output = assembler.getOutput();
+        TEST_CHECK(output.size() > resolver.findSection(".text"));
+        TEST_CHECK(output[0].offset == 0);
+        TEST_CHECK(output[0].words == expected);
+
+        auto code = assembler.takeOutput(1);
+        TEST_CHECK(code.at(0).words == expected);
+        TEST_CHECK(assembler.getOutput().empty());
+
+        // Local labels restart with new unit, sections continue.
+        assembler.assembleLine("1:");
+        assembler.assembleLine("beq %r0, %r0, 1b");
+        assembler.finishUnit();
+
+        TEST_CHECK(assembler.getOutput().at(0).offset == expected.size());
+        TEST_CHECK((assembler.getOutput().at(0).words == std::vector<std::uint16_t>{encode(6, 0, 0, std::uint64_t(-1))}));
+    }
+
+    // Code of other sections goes to their own buffers, against their final base.
+    {
+        Resolver resolver;
+        Table table(resolver);
+        Assembler assembler(table, resolver, 0);
+
+        LineReader reader{{
+            "beq %r0, %r0, handler",
+            ".section .vectors",
+            "handler:",
+            "beq %r0, %r0, handler",
+            ".section .text",
+            "add %r1, %r1, %r1"
+        }};
+
+        assembler.assemble(reader);
+
+        const auto& output = assembler.getOutput();
+        auto vectors = resolver.findSection(".vectors");
+        TEST_CHECK(resolver.getSectionBase(vectors) == 2);
+        TEST_CHECK((output[0].words == std::vector<std::uint16_t>{encode(6, 0, 0, 1), encode(0, 1, 1, 1)}));
+        TEST_CHECK((output.at(vectors).words == std::vector<std::uint16_t>{encode(6, 0, 0, std::uint64_t(-1))}));
+    }
+
+    // Errors of unresolved and unencodable instructions.
+    {
+        Resolver resolver;
+        Table table(resolver);
+        Assembler assembler(table, resolver, 0);
+
+        assembler.assembleLine("beq %r0, %r0, nowhere");
+        TEST_CHECK_THROWS(assembler.finishUnit(), std::invalid_argument);
+
+        TEST_CHECK_THROWS(assembler.assembleLine("addi %r1, %r1, $100"), std::out_of_range);
+        TEST_CHECK_THROWS(assembler.assembleLine("beq %r0, %r0, 2b"), std::invalid_argument);
+    }
+
+    return test::result();
+}
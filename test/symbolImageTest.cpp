@@ -0,0 +1,194 @@
+/**
+ * @file symbolImageTest.cpp 
+ * @author Harith Manoj (harithpub@gmail.com)
+ * @brief Tests of symbol image round trip and rejection of corrupt images.
+ * @date 17 October 2026
+ * 
+ * @copyright Copyright (C) 2024
+ * 
+ * 
+ *                      GNU GENERAL PUBLIC LICENSE 
+ *                        Version 3, 29 June 2007 
+ * 
+ * This program is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published by 
+ * the Free Software Foundation, either version 3 of the License, or 
+ * (at your option) any later version. 
+ *  
+ * This program is distributed in the hope that it will be useful, 
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details. 
+ *  
+ * You should have received a copy of the GNU General Public License 
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+#include <cstddef>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../src/asm.cpp"
+#include <genAsmLib/symbolImage.h>
+
+#include "testCheck.h"
+
+using Traits = risc16::AssemblerTraits;
+using Resolver = gen_asm::AddressResolver<Traits, Traits>;
+using Table = gen_asm::SymbolTable<Traits, Traits, Resolver>;
+
+/// @brief Check image resolves every subscript of every symbol of table as table does, from its own unit.
+bool resolvesAsTable(const Table& table, const gen_asm::SymbolImageView& view)
+{
+    if(view.size() != table.size() || view.getBaseAddress() != table.getBaseAddress())
+        return false;
+
+    for(std::size_t s = 0; s < table.size(); ++s)
+    {
+        auto id = table.translationUnitId(s);
+        std::string name(table.symbolName(s));
+
+        std::size_t count = 1;
+        std::size_t splits = 1;
+
+        if(table.symbolType(s) != gen_asm::SymbolType::JUMP)
+        {
+            const auto record = view[*view.find(name, id)];
+            count = std::max<std::size_t>(record.elementCount, 1);
+            splits = record.sizeInBasic;
+        }
+
+        for(std::size_t i = 0; i < count; ++i)
+            for(std::size_t j = 0; j < splits; ++j)
+                if(view.resolveSymbol(id, name, i, j) != table.resolveSymbol(id, {name, i, j}))
+                    return false;
+    }
+
+    return true;
+}
+
+int main()
+{
+    Resolver resolver;
+    Table table(resolver);
+    gen_asm::Tokenizer<Traits, Traits> tokenizer;
+
+    auto assemble = [&](std::size_t id, std::string_view line)
+    {
+        tokenizer.tokenize(line);
+
+        if(tokenizer.isSymbol())
+            table.addSymbol(id, tokenizer.getSymbol());
+        else
+            resolver.updateOffsets(tokenizer.getInstruction());
+    };
+
+    assemble(0, "start: .export");
+    assemble(0, "add %r1, %r1, %r1");
+    assemble(0, "movi %r1, $4");
+    assemble(0, "loop:");
+    assemble(0, "buf: .data .dword [3] 1, 2");
+    assemble(0, "end: .data .word [0]");
+    assemble(0, "k: .const .dword [2] 0x12345678, 9");
+    assemble(1, "loop:");
+    assemble(1, "k: .const .word [1] 0x1234");
+    assemble(1, "msg: .data .ascii \"hi\"");
+    assemble(1, "shared: .export .const .word [2] 1, 2");
+
+    table.setBaseAddress(0x100, 0x2000);
+
+    auto image = gen_asm::serializeSymbolTable(table);
+    gen_asm::SymbolImageView view{std::span<const std::byte>(image)};
+
+    TEST_CHECK(resolvesAsTable(table, view));
+
+    // Visibility follows table, locals of other units are hidden, exports are not.
+    TEST_CHECK(view.resolveSymbol(1, "loop") == 0x103);
+    TEST_CHECK(view.resolveSymbol(0, "loop") == 0x103);
+    TEST_CHECK(view.resolveSymbol(1, "start") == 0x100);
+    TEST_CHECK(view.resolveSymbol(0, "shared", 1) == 2);
+    TEST_CHECK(!view.find("buf", 1).has_value());
+    TEST_CHECK(view.resolveSymbol(0, "k", 1) == 9);
+    TEST_CHECK(view.resolveSymbol(0, "end") == 0x2006);
+
+    TEST_CHECK_THROWS((void)view.resolveSymbol(1, "buf"), std::invalid_argument);
+    TEST_CHECK_THROWS((void)view.resolveSymbol(0, "start", 1), std::invalid_argument);
+    TEST_CHECK_THROWS((void)view.resolveSymbol(0, "buf", 3), std::out_of_range);
+    TEST_CHECK_THROWS((void)view.resolveSymbol(0, "buf", 0, 2), std::out_of_range);
+    TEST_CHECK_THROWS((void)view.constValue(view[*view.find("buf", 0)], 0), std::out_of_range);
+
+    // Image of empty table.
+    {
+        Resolver emptyResolver;
+        Table empty(emptyResolver);
+        auto emptyImage = gen_asm::serializeSymbolTable(empty);
+        gen_asm::SymbolImageView emptyView{std::span<const std::byte>(emptyImage)};
+        TEST_CHECK((emptyView.size() == 0) && !emptyView.find("start", 0).has_value());
+    }
+
+    // Truncated images and wrong header fields are rejected.
+    std::size_t accepted = 0;
+    for(std::size_t size = 0; size < image.size(); ++size)
+    {
+        std::vector<std::byte> truncated(image.begin(), image.begin() + size);
+        try
+        {
+            gen_asm::SymbolImageView truncatedView{std::span<const std::byte>(truncated)};
+            ++accepted;
+        }
+        catch(const std::invalid_argument&) {}
+    }
+    TEST_CHECK(accepted == 0);
+
+    auto withField = [&](std::size_t offset, std::uint32_t value)
+    {
+        auto corrupt = image;
+        std::memcpy(corrupt.data() + offset, &value, sizeof(value));
+        return corrupt;
+    };
+
+    for(auto corrupt : {
+        withField(offsetof(gen_asm::SymbolImageHeader, magic), 0),
+        withField(offsetof(gen_asm::SymbolImageHeader, version), gen_asm::literal::SYMBOL_IMAGE_VERSION + 1),
+        withField(offsetof(gen_asm::SymbolImageHeader, byteOrder), 0x04030201),
+        withField(offsetof(gen_asm::SymbolImageHeader, symbolCount), 0xFFFFFFFF),
+        withField(offsetof(gen_asm::SymbolImageHeader, bucketCount), 0xFFFFFF),
+        withField(offsetof(gen_asm::SymbolImageHeader, stringSize), 0xFFFFFF),
+        withField(offsetof(gen_asm::SymbolImageHeader, recordOffset), 0xFFFFFFF8),
+        withField(sizeof(gen_asm::SymbolImageHeader) + offsetof(gen_asm::SymbolImageRecord, nameOffset), 0xFFFFFF),
+        withField(sizeof(gen_asm::SymbolImageHeader) + offsetof(gen_asm::SymbolImageRecord, nextInBucket), 1000)
+    })
+        TEST_CHECK_THROWS(gen_asm::SymbolImageView{std::span<const std::byte>(corrupt)}, std::invalid_argument);
+
+    // Randomly corrupted images are rejected, or every query on them stays in bounds.
+    std::mt19937 random(36);
+    for(int round = 0; round < 3000; ++round)
+    {
+        auto corrupt = image;
+        for(int flip = 0, flips = 1 + random() % 4; flip < flips; ++flip)
+            corrupt[random() % corrupt.size()] = std::byte(random());
+
+        try
+        {
+            gen_asm::SymbolImageView corruptView{std::span<const std::byte>(corrupt)};
+
+            for(std::size_t i = 0; i < corruptView.size(); ++i)
+            {
+                auto record = corruptView[i];
+                auto name = corruptView.name(record);
+
+                try { (void)corruptView.resolveSymbol(record.translationUnitId, name, 1, 1); } catch(const std::exception&) {}
+                try { (void)corruptView.constValue(record, 0); } catch(const std::exception&) {}
+            }
+
+            (void)corruptView.find("loop", 1);
+        }
+        catch(const std::invalid_argument&) {}
+    }
+
+    return test::result();
+}
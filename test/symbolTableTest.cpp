@@ -0,0 +1,142 @@
+/**
+ * @file symbolTableTest.cpp 
+ * @author Harith Manoj (harithpub@gmail.com)
+ * @brief Tests of columns, records, conflicts and stats of symbol table.
+ * @date 17 October 2026
+ * 
+ * @copyright Copyright (C) 2024
+ * 
+ * 
+ *                      GNU GENERAL PUBLIC LICENSE 
+ *                        Version 3, 29 June 2007 
+ * 
+ * This program is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published by 
+ * the Free Software Foundation, either version 3 of the License, or 
+ * (at your option) any later version. 
+ *  
+ * This program is distributed in the hope that it will be useful, 
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details. 
+ *  
+ * You should have received a copy of the GNU General Public License 
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+#include <algorithm>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "../src/asm.cpp"
+
+#include "testCheck.h"
+
+using Traits = risc16::AssemblerTraits;
+using Resolver = gen_asm::AddressResolver<Traits, Traits>;
+using Table = gen_asm::SymbolTable<Traits, Traits, Resolver>;
+
+gen_asm::SymbolToken<Traits> symbol(std::string_view line)
+{
+    gen_asm::Tokenizer<Traits, Traits> tokenizer;
+    tokenizer.tokenize(line);
+    return tokenizer.getSymbol();
+}
+
+int main()
+{
+    Resolver resolver;
+    Table table(resolver);
+    gen_asm::Tokenizer<Traits, Traits> tokenizer;
+
+    table.addSymbol(0, symbol("start: .export"));
+    tokenizer.tokenize("movi %r1, $4");
+    resolver.updateOffsets(tokenizer.getInstruction());
+    table.addSymbol(0, symbol("loop:"));
+    table.addSymbol(0, symbol("buf: .data .dword [3] 1, 2"));
+    table.addSymbol(0, symbol("k: .const .word [2] 7, 9"));
+    table.addSymbol(1, symbol("k: .const .word [2] 7, 9"));
+    table.addSymbol(1, symbol("loop:"));
+    table.addSymbol(1, symbol("other: .export .const .word [3] 7, 9, 1"));
+
+    // Columns and records materialised from them.
+    TEST_CHECK(table.size() == 7);
+    TEST_CHECK((table.symbolName(2) == "buf") && (table.translationUnitId(5) == 1) && table.isExport(6) && !table.isExport(1));
+    TEST_CHECK((table.symbolType(0) == gen_asm::SymbolType::JUMP) && (table.symbolType(2) == gen_asm::SymbolType::DATA));
+
+    auto loop = std::get<gen_asm::JumpSymbol<Traits, Traits>>(table[1]);
+    TEST_CHECK((loop.symbolName == "loop") && (loop.codeAddressOffset == 2) && (loop.section == 0));
+
+    auto buf = std::get<gen_asm::DataSymbol<Traits, Traits>>(table[2]);
+    TEST_CHECK((buf.dataAddressOffset == 0) && (buf.elementCount == 3) && (buf.section == 1));
+
+    auto k = std::get<gen_asm::ConstSymbol<Traits, Traits>>(table[4]);
+    TEST_CHECK(std::ranges::equal(k.init_value, std::vector<std::uint64_t>{7, 9}));
+
+    std::size_t visited = 0;
+    for(auto record : table)
+        visited += std::visit([](const auto& sym) { return sym.symbolName.empty() ? 0 : 1; }, record);
+    TEST_CHECK(visited == table.size());
+
+    // Identical const tables share a pool slice, prefixes of other tables do not.
+    TEST_CHECK(table.constantSlice(3) == table.constantSlice(4));
+    TEST_CHECK(!(table.constantSlice(3) == table.constantSlice(6)));
+    TEST_CHECK(table.getConstantPool().size() == 5);
+
+    // Conflicts within unit and with exports.
+    TEST_CHECK_THROWS(table.addSymbol(0, symbol("loop:")), std::domain_error);
+    TEST_CHECK_THROWS(table.addSymbol(1, symbol("start:")), std::domain_error);
+    TEST_CHECK_THROWS(table.addSymbol(2, symbol("loop: .export")), std::domain_error);
+    table.addSymbol(2, symbol("loop:"));
+    TEST_CHECK(table.size() == 8);
+
+    // Failed batch adds nothing, and reports every conflict.
+    {
+        std::vector<gen_asm::BatchSymbol<Traits>> batch = {
+            {symbol("fresh:"), 0, 0},
+            {symbol("start:"), 0, 0},
+            {symbol("fresh:"), 0, 0}
+        };
+
+        std::string message;
+        try { table.addSymbols(1, batch); }
+        catch(const std::domain_error& error) { message = error.what(); }
+
+        TEST_CHECK(std::ranges::count(message, '\n') == 1);
+        TEST_CHECK(table.size() == 8);
+
+        auto dataOffset = resolver.getDataAddressOffset();
+        batch = {{symbol("fine: .data .word [1]"), 0, 0}, {symbol("huge: .data .qword [0x4000]"), 0, 0}};
+        TEST_CHECK_THROWS(table.addSymbols(1, batch), std::out_of_range);
+        TEST_CHECK((table.size() == 8) && (resolver.getDataAddressOffset() == dataOffset));
+
+        batch = {{symbol("fine: .data .word [1]"), 0, 0}, {symbol("late:"), 5, 0}};
+        table.addSymbols(1, batch);
+        TEST_CHECK((table.size() == 10) && (table.resolveSymbol(1, {"late"}) == 5));
+    }
+
+    // Lookups by unit, handles and stats.
+    table.setBaseAddress(0x100, 0x2000);
+    table.resetStats();
+
+    TEST_CHECK(table.resolveSymbol(1, {"loop"}) == 0x102);
+    TEST_CHECK(table.resolveSymbol(0, {"loop"}) == 0x102);
+    TEST_CHECK(table.resolveSymbol(1, {"start"}) == 0x100);
+    TEST_CHECK(table.resolveSymbol(0, {"buf", 2, 1}) == 0x2005);
+    TEST_CHECK(table.resolveSymbol(0, {"other", 2}) == 1);
+    TEST_CHECK(!table.tryBind(0, {"absent"}).has_value());
+    TEST_CHECK(!table.tryBind(0, {"fine"}).has_value());
+    TEST_CHECK_THROWS((void)table.bind(0, {"loop", 1}), std::invalid_argument);
+    TEST_CHECK_THROWS((void)table.bind(0, {"buf", 3}), std::out_of_range);
+
+    auto stats = table.getStats();
+    TEST_CHECK((stats.jumpSymbols == 5) && (stats.dataSymbols == 2) && (stats.constSymbols == 3) && (stats.exportedSymbols == 2));
+    TEST_CHECK(stats.constPayloadBytes == 5 * sizeof(std::uint64_t));
+    TEST_CHECK(stats.lookups == stats.hits + stats.misses);
+    TEST_CHECK((stats.hits >= 5) && (stats.misses + stats.filterRejects >= 2));
+
+    return test::result();
+}
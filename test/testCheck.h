@@ -0,0 +1,68 @@
+/**
+ * @file testCheck.h 
+ * @author Harith Manoj (harithpub@gmail.com)
+ * @brief Minimal checks shared by unit tests.
+ * @date 17 October 2026
+ * 
+ * @copyright Copyright (C) 2024
+ * 
+ * 
+ *                      GNU GENERAL PUBLIC LICENSE 
+ *                        Version 3, 29 June 2007 
+ * 
+ * This program is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published by 
+ * the Free Software Foundation, either version 3 of the License, or 
+ * (at your option) any later version. 
+ *  
+ * This program is distributed in the hope that it will be useful, 
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details. 
+ *  
+ * You should have received a copy of the GNU General Public License 
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+#ifndef TEST_TESTCHECK_H_INCLUDED
+
+/// @brief test\testCheck.h Header Guard 
+#define TEST_TESTCHECK_H_INCLUDED
+
+#include <cstdlib>
+#include <iostream>
+
+namespace test
+{
+    /// @brief Number of failed checks of test executable.
+    inline int failureCount = 0;
+
+    inline void check(bool condition, const char* expression, const char* file, int line)
+    {
+        if(condition)
+            return;
+
+        std::cerr << file << ":" << line << ": check failed: " << expression << "\n";
+        ++failureCount;
+    }
+
+    /// @brief Exit status of test executable, failure if any check failed.
+    inline int result() noexcept { return (failureCount == 0) ? EXIT_SUCCESS : EXIT_FAILURE; }
+}
+
+/// @brief Record failure of expression without stopping test.
+#define TEST_CHECK(expression) ::test::check(static_cast<bool>(expression), #expression, __FILE__, __LINE__)
+
+/// @brief Record failure unless statement throws exception of type.
+#define TEST_CHECK_THROWS(statement, exception) \
+    do \
+    { \
+        bool thrown_ = false; \
+        try { statement; } catch(const exception&) { thrown_ = true; } \
+        ::test::check(thrown_, #statement " throws " #exception, __FILE__, __LINE__); \
+    } while(false)
+
+
+#endif // TEST_TESTCHECK_H_INCLUDED
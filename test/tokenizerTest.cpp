@@ -0,0 +1,102 @@
+/**
+ * @file tokenizerTest.cpp 
+ * @author Harith Manoj (harithpub@gmail.com)
+ * @brief Tests of operand pattern tokenizing into fixed operands.
+ * @date 17 October 2026
+ * 
+ * @copyright Copyright (C) 2024
+ * 
+ * 
+ *                      GNU GENERAL PUBLIC LICENSE 
+ *                        Version 3, 29 June 2007 
+ * 
+ * This program is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published by 
+ * the Free Software Foundation, either version 3 of the License, or 
+ * (at your option) any later version. 
+ *  
+ * This program is distributed in the hope that it will be useful, 
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details. 
+ *  
+ * You should have received a copy of the GNU General Public License 
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+#include <cstdint>
+#include <string_view>
+
+#include "../src/asm.cpp"
+
+#include "testCheck.h"
+
+using Tokenizer = gen_asm::Tokenizer<risc16::AssemblerTraits, risc16::AssemblerTraits>;
+
+/// @brief Instruction of single line.
+gen_asm::InstructionToken<risc16::AssemblerTraits> instruction(std::string_view line)
+{
+    Tokenizer tokenizer;
+    tokenizer.tokenize(line);
+    return tokenizer.getInstruction();
+}
+
+int main()
+{
+    // Registers and literal immediates parse into fixed operands only.
+    auto addi = instruction("addi %r1, %sp, $-5");
+    TEST_CHECK(addi.opCode == 1);
+    TEST_CHECK(addi.operands.count == 3);
+    TEST_CHECK(addi.operands.isResolved());
+    TEST_CHECK(addi.operands.values[0] == 1);
+    TEST_CHECK(addi.operands.values[1] == 2);
+    TEST_CHECK(addi.operands.values[2] == std::uint64_t(-5));
+    TEST_CHECK(addi.registerArgs.empty() && addi.immediateArgs.empty());
+
+    // Fixed operands feed encoder directly.
+    TEST_CHECK(risc16::encoding::encode(addi.opCode, addi.operands.view()) == 0b001'001'010'1111011);
+    
+    auto nand = instruction("nand %r7, %r6, %r5");
+    TEST_CHECK(risc16::encoding::encode(nand.opCode, nand.operands.view()) == 0b010'111'110'0000'101);
+
+    // Constant expressions and character literals fold into fixed operands.
+    auto lui = instruction("lui %r1, $(3 + 4) * 2");
+    TEST_CHECK(lui.operands.isResolved() && (lui.operands.values[1] == 14));
+    TEST_CHECK(instruction("lui %r1, 'a'").operands.values[1] == 'a');
+
+    // Symbol, local label and expression operands stay unresolved in their lists.
+    auto beq = instruction("beq %r1, %r2, loop");
+    TEST_CHECK(beq.operands.count == 3);
+    TEST_CHECK(beq.operands.isResolved(0) && beq.operands.isResolved(1));
+    TEST_CHECK(!beq.operands.isResolved(2) && !beq.operands.isResolved());
+    TEST_CHECK((beq.symbolArgs.size() == 1) && (beq.symbolArgs[0].first == 2));
+
+    auto local = instruction("beq %r0, %r0, 1f");
+    TEST_CHECK((local.localLabelArgs.size() == 1) && !local.operands.isResolved(2));
+
+    auto expression = instruction("lw %r1, %r2, table + 1");
+    TEST_CHECK((expression.expressionArgs.size() == 1) && !expression.operands.isResolved(2));
+
+    // Instructions without operands.
+    auto ret = instruction("ret");
+    TEST_CHECK((ret.operands.count == 0) && ret.operands.isResolved());
+
+    // Operand count and kind follow pattern.
+    TEST_CHECK_THROWS((void)instruction("add %r1, %r2"), std::invalid_argument);
+    TEST_CHECK_THROWS((void)instruction("jalr %r1, %r2, %r3"), std::invalid_argument);
+    TEST_CHECK_THROWS((void)instruction("add %r1, %r2, $3"), std::invalid_argument);
+
+    // Numbers are parsed whole, overflow is reported.
+    TEST_CHECK_THROWS((void)instruction("lui %r1, $0x10000000000000000"), std::out_of_range);
+    TEST_CHECK_THROWS((void)instruction("lui %r1, $12a"), std::invalid_argument);
+    TEST_CHECK_THROWS((void)instruction("lw %r1, %r2, table[1x]"), std::invalid_argument);
+    auto indexed = instruction("lw %r1, %r2, table[0x10][2]").symbolArgs.at(0).second;
+    TEST_CHECK((std::get<1>(indexed) == 16) && (std::get<2>(indexed) == 2));
+
+    // Values out of field range are rejected by encoder.
+    TEST_CHECK_THROWS((void)risc16::encoding::encode(1, instruction("addi %r1, %r1, $64").operands.view()), std::out_of_range);
+
+    return test::result();
+}
@@ -0,0 +1,97 @@
+/**
+ * @file whiteSpaceTest.cpp 
+ * @author Harith Manoj (harithpub@gmail.com)
+ * @brief Tests of word at a time whitespace scanning.
+ * @date 17 October 2026
+ * 
+ * @copyright Copyright (C) 2024
+ * 
+ * 
+ *                      GNU GENERAL PUBLIC LICENSE 
+ *                        Version 3, 29 June 2007 
+ * 
+ * This program is free software: you can redistribute it and/or modify 
+ * it under the terms of the GNU General Public License as published by 
+ * the Free Software Foundation, either version 3 of the License, or 
+ * (at your option) any later version. 
+ *  
+ * This program is distributed in the hope that it will be useful, 
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of 
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details. 
+ *  
+ * You should have received a copy of the GNU General Public License 
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+#include <string>
+#include <vector>
+
+#include <easyParseLib/easyParse.h>
+
+#include "testCheck.h"
+
+/// @brief View of characters in buffer of exactly their size, so reads past end are caught by sanitizers.
+struct ExactBuffer
+{
+    std::vector<char> data;
+
+    explicit ExactBuffer(std::string_view text) : data(text.begin(), text.end()) {}
+
+    std::string_view view() const noexcept { return {data.data(), data.size()}; }
+};
+
+/// @brief Character by character reference of `advanceOverWhiteSpace`.
+std::size_t referenceAdvance(std::string_view line, std::size_t offset)
+{
+    for(; offset < line.size(); ++offset)
+        if(!easyParse::isWhiteSpace(line[offset]))
+            return offset;
+
+    return line.npos;
+}
+
+int main()
+{
+    using easyParse::advanceOverWhiteSpace;
+    using easyParse::retreatOverWhiteSpace;
+    constexpr auto npos = std::string_view::npos;
+
+    // Offset at or past end, including npos passed on by tokenizer.
+    ExactBuffer word("buf: .data .word");
+    TEST_CHECK(advanceOverWhiteSpace(word.view(), npos) == npos);
+    TEST_CHECK(advanceOverWhiteSpace(word.view(), word.data.size()) == npos);
+    TEST_CHECK(advanceOverWhiteSpace(word.view(), word.data.size() + 1) == npos);
+
+    // Empty line.
+    TEST_CHECK(advanceOverWhiteSpace(std::string_view()) == npos);
+    TEST_CHECK(retreatOverWhiteSpace(std::string_view()) == npos);
+    TEST_CHECK(easyParse::stripWhiteSpace(std::string_view()).empty());
+
+    // Fewer than 8 characters.
+    ExactBuffer shortLine(" \t x ");
+    TEST_CHECK(advanceOverWhiteSpace(shortLine.view()) == 3);
+    TEST_CHECK(retreatOverWhiteSpace(shortLine.view()) == 3);
+    TEST_CHECK(advanceOverWhiteSpace(shortLine.view(), 4) == npos);
+
+    // All blank lines, on and off word boundaries.
+    for(std::size_t size : {1, 7, 8, 9, 16, 23})
+    {
+        ExactBuffer blank(std::string(size, ' '));
+        TEST_CHECK(advanceOverWhiteSpace(blank.view()) == npos);
+        TEST_CHECK(retreatOverWhiteSpace(blank.view()) == npos);
+        TEST_CHECK(easyParse::stripWhiteSpace(blank.view()).empty());
+    }
+
+    // Word scan agrees with character scan at every offset.
+    ExactBuffer mixed("        \t\t  add %r1,  %r2, %r3  \n\r   \v\f        x          ");
+    for(std::size_t offset = 0; offset <= mixed.data.size(); ++offset)
+        TEST_CHECK(advanceOverWhiteSpace(mixed.view(), offset) == referenceAdvance(mixed.view(), offset));
+
+    static_assert(advanceOverWhiteSpace("   x", 0) == 3);
+    static_assert(advanceOverWhiteSpace("   x", npos) == npos);
+
+    return test::result();
+}